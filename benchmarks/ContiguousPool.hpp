@@ -0,0 +1,234 @@
+#pragma once
+
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <bit>
+#include "Config.hpp"
+#include "Handle.hpp"
+
+/**
+ * @brief Fixed-capacity pool that keeps every object in one aligned buffer
+ *
+ * Free slots hold the index of the next free slot (an intrusive free list), so
+ * the pool needs no side allocation per object. Occupancy is tracked in a
+ * bitmap, and the active-index list is rebuilt from it lazily, so iteration
+ * always walks the buffer front to back.
+ *
+ * Unlike ObjectPool, objects are constructed on acquire() and destroyed on
+ * release(); a free slot's storage is reused for the free-list link. Slot
+ * generations live beside the buffer so handles survive that reuse.
+ */
+template<typename T>
+class ContiguousPool {
+public:
+    using HandleType = Handle<T>;
+
+    struct Statistics {
+        size_t totalAllocated = 0;
+        size_t currentActive = 0;
+        size_t peakActive = 0;
+        size_t totalAcquired = 0;
+        size_t totalReleased = 0;
+    };
+
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+    static constexpr size_t BufferAlignment = std::max<size_t>(alignof(T), 64); // Cache line
+
+private:
+    union Slot {
+        T object;
+        uint32_t nextFree;
+
+        Slot() noexcept : nextFree(InvalidIndex) {}
+        ~Slot() {}
+    };
+
+    Slot* m_slots = nullptr;
+    size_t m_capacity = 0;
+    uint32_t m_freeHead = InvalidIndex;
+    std::vector<uint64_t> m_occupied;          // One bit per slot
+    std::vector<uint16_t> m_generations;       // One per slot, bumped on release
+    std::vector<uint32_t> m_activeIndices;     // Storage-ordered, rebuilt when dirty
+    bool m_activeDirty = false;
+    Statistics m_stats;
+
+public:
+    ContiguousPool() = default;
+    ~ContiguousPool() { destroy(); }
+
+    ContiguousPool(const ContiguousPool&) = delete;
+    ContiguousPool& operator=(const ContiguousPool&) = delete;
+
+    void initialize(size_t capacity) {
+        GAME_ASSERT(capacity > 0, "Pool size must be greater than 0");
+        GAME_ASSERT(capacity <= HandleType::MaxIndex + size_t{1}, "Pool size exceeds handle index range");
+        destroy();
+
+        m_slots = static_cast<Slot*>(::operator new(sizeof(Slot) * capacity, std::align_val_t{BufferAlignment}));
+        m_capacity = capacity;
+
+        // Thread the free list front to back so the first acquires are adjacent
+        for (size_t i = 0; i < capacity; ++i) {
+            ::new (&m_slots[i]) Slot();
+            m_slots[i].nextFree = i + 1 < capacity ? static_cast<uint32_t>(i + 1) : InvalidIndex;
+        }
+        m_freeHead = 0;
+
+        m_occupied.assign((capacity + 63) / 64, 0);
+        m_generations.assign(capacity, 1);
+        m_activeIndices.clear();
+        m_activeIndices.reserve(capacity);
+        m_activeDirty = false;
+
+        m_stats = Statistics{};
+        m_stats.totalAllocated = capacity;
+    }
+
+    template<typename... Args>
+    [[nodiscard]] T* acquire(Args&&... args) {
+        if (m_freeHead == InvalidIndex) {
+            return nullptr;
+        }
+
+        const uint32_t index = m_freeHead;
+        Slot& slot = m_slots[index];
+        const uint32_t next = slot.nextFree;
+
+        // Construction reuses the link's storage; restore it if T's constructor throws
+        T* obj = nullptr;
+        try {
+            obj = ::new (&slot.object) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot.nextFree = next;
+            throw;
+        }
+        m_freeHead = next;
+        m_occupied[index >> 6] |= (uint64_t{1} << (index & 63));
+        m_activeDirty = true;
+
+        m_stats.currentActive++;
+        m_stats.totalAcquired++;
+        m_stats.peakActive = std::max(m_stats.peakActive, m_stats.currentActive);
+
+        return obj;
+    }
+
+    template<typename... Args>
+    [[nodiscard]] HandleType acquireHandle(Args&&... args) {
+        T* obj = acquire(std::forward<Args>(args)...);
+        return obj ? handleOf(obj) : HandleType{};
+    }
+
+    // nullptr for null handles and for handles whose object was released
+    [[nodiscard]] T* get(HandleType handle) noexcept {
+        return isValid(handle) ? &m_slots[handle.index()].object : nullptr;
+    }
+
+    [[nodiscard]] bool isValid(HandleType handle) const noexcept {
+        const uint32_t index = handle.index();
+        return !handle.isNull() && isActive(index) && m_generations[index] == handle.generation();
+    }
+
+    [[nodiscard]] HandleType handleOf(const T* obj) const noexcept {
+        const uint32_t index = indexOf(obj);
+        return HandleType(index, m_generations[index]);
+    }
+
+    // Stale or null handles are ignored
+    void release(HandleType handle) noexcept {
+        if (isValid(handle)) {
+            release(&m_slots[handle.index()].object);
+        }
+    }
+
+    void release(T* obj) noexcept {
+        if (!obj) return;
+
+        const uint32_t index = indexOf(obj);
+        GAME_ASSERT(index < m_capacity && isActive(index), "Releasing object not owned by this pool");
+
+        obj->~T();
+        m_generations[index] = static_cast<uint16_t>(HandleType::nextGeneration(m_generations[index]));
+        m_slots[index].nextFree = m_freeHead;
+        m_freeHead = index;
+        m_occupied[index >> 6] &= ~(uint64_t{1} << (index & 63));
+        m_activeDirty = true;
+
+        if (m_stats.currentActive > 0) {
+            m_stats.currentActive--;
+        }
+        m_stats.totalReleased++;
+    }
+
+    void releaseAll() noexcept {
+        for (uint32_t index : activeIndices()) {
+            release(&m_slots[index].object);
+        }
+    }
+
+    // Visit live objects in buffer order
+    template<typename Func>
+    void forEachActive(Func&& func) {
+        for (uint32_t index : activeIndices()) {
+            func(m_slots[index].object);
+        }
+    }
+
+    // Indices of live objects in ascending (storage) order
+    [[nodiscard]] const std::vector<uint32_t>& activeIndices() {
+        if (m_activeDirty) {
+            rebuildActiveIndices();
+        }
+        return m_activeIndices;
+    }
+
+    [[nodiscard]] T& operator[](uint32_t index) noexcept { return m_slots[index].object; }
+    [[nodiscard]] const T& operator[](uint32_t index) const noexcept { return m_slots[index].object; }
+
+    [[nodiscard]] uint32_t indexOf(const T* obj) const noexcept {
+        return static_cast<uint32_t>(reinterpret_cast<const Slot*>(obj) - m_slots);
+    }
+
+    [[nodiscard]] bool isActive(uint32_t index) const noexcept {
+        return index < m_capacity && (m_occupied[index >> 6] >> (index & 63)) & 1;
+    }
+
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+    [[nodiscard]] size_t getAvailableCount() const noexcept { return m_capacity - m_stats.currentActive; }
+    [[nodiscard]] size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] float getUsageRatio() const noexcept {
+        return m_capacity > 0 ?
+               static_cast<float>(m_stats.currentActive) / static_cast<float>(m_capacity) : 0.0f;
+    }
+
+private:
+    void rebuildActiveIndices() {
+        m_activeIndices.clear();
+        for (size_t word = 0; word < m_occupied.size(); ++word) {
+            uint64_t bits = m_occupied[word];
+            while (bits) {
+                const int bit = std::countr_zero(bits);
+                m_activeIndices.push_back(static_cast<uint32_t>(word * 64 + bit));
+                bits &= bits - 1;
+            }
+        }
+        m_activeDirty = false;
+    }
+
+    void destroy() noexcept {
+        if (!m_slots) return;
+
+        releaseAll();
+        for (size_t i = 0; i < m_capacity; ++i) {
+            m_slots[i].~Slot();
+        }
+        ::operator delete(m_slots, std::align_val_t{BufferAlignment});
+
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_freeHead = InvalidIndex;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,321 @@
+// Compares the per-frame cost of the old GameObject-style virtual dispatch
+// against std::variant batches and the World's static system loops, for the
+// two hot paths: moving every entity and the bullet x enemy bounds test.
+//
+// Build with -DSPACEDEFENDER_BUILD_BENCHMARKS=ON, then run ./build/DispatchBenchmark
+
+#include "World.hpp"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <variant>
+#include <vector>
+#include <algorithm>
+
+namespace {
+    struct Box {
+        float left, top, width, height;
+    };
+
+    bool intersects(const Box& a, const Box& b) noexcept {
+        return a.left < b.left + b.width && b.left < a.left + a.width &&
+               a.top < b.top + b.height && b.top < a.top + a.height;
+    }
+
+    // --- Virtual hierarchy, shaped like the removed GameObject base ---------
+
+    class Object {
+    protected:
+        float m_x = 0.0f, m_y = 0.0f;
+        float m_vx = 0.0f, m_vy = 0.0f;
+        float m_width = 0.0f, m_height = 0.0f;
+
+    public:
+        virtual ~Object() = default;
+        virtual void update(float dt) = 0;
+        virtual Box getBounds() const = 0;
+        float x() const noexcept { return m_x; }
+
+        void place(float x, float y, float vx, float vy) noexcept {
+            m_x = x; m_y = y; m_vx = vx; m_vy = vy;
+        }
+    };
+
+    class VirtualBullet final : public Object {
+    public:
+        VirtualBullet() { m_width = 4.0f; m_height = 4.0f; }
+        void update(float dt) override {
+            m_x += m_vx * dt;
+            m_y += m_vy * dt;
+        }
+        Box getBounds() const override { return {m_x - 2.0f, m_y - 2.0f, m_width, m_height}; }
+    };
+
+    class VirtualEnemy final : public Object {
+        float m_tightness = 0.8f;
+    public:
+        VirtualEnemy() { m_width = 40.0f; m_height = 40.0f; }
+        void update(float dt) override {
+            m_x += m_vx * dt;
+            m_y += m_vy * dt;
+        }
+        Box getBounds() const override {
+            const float w = m_width * m_tightness, h = m_height * m_tightness;
+            return {m_x - w * 0.5f, m_y - h * 0.5f, w, h};
+        }
+    };
+
+    class VirtualParticle final : public Object {
+        float m_age = 0.0f;
+    public:
+        void update(float dt) override {
+            m_x += m_vx * dt;
+            m_y += m_vy * dt;
+            m_age += dt;
+        }
+        Box getBounds() const override { return {m_x, m_y, 0.0f, 0.0f}; }
+    };
+
+    // --- std::variant batch ---------------------------------------------------
+
+    struct PlainBullet {
+        float x, y, vx, vy;
+        void update(float dt) noexcept { x += vx * dt; y += vy * dt; }
+        Box bounds() const noexcept { return {x - 2.0f, y - 2.0f, 4.0f, 4.0f}; }
+    };
+
+    struct PlainEnemy {
+        float x, y, vx, vy;
+        void update(float dt) noexcept { x += vx * dt; y += vy * dt; }
+        Box bounds() const noexcept { return {x - 16.0f, y - 16.0f, 32.0f, 32.0f}; }
+    };
+
+    struct PlainParticle {
+        float x, y, vx, vy, age;
+        void update(float dt) noexcept { x += vx * dt; y += vy * dt; age += dt; }
+        Box bounds() const noexcept { return {x, y, 0.0f, 0.0f}; }
+    };
+
+    using AnyEntity = std::variant<PlainBullet, PlainEnemy, PlainParticle>;
+
+    // --- ECS components, mirroring Components.hpp without SFML -------------
+
+    struct Position { float x, y; };
+    struct Speed { float x, y; };
+    struct Extent { float halfWidth, halfHeight; };
+    struct BulletTag { bool fromPlayer; };
+    struct EnemyTag { float tightness; };
+    struct ParticleAge { float age; };
+
+    Box boxOf(const Position& p, const Extent& e, float tightness = 1.0f) noexcept {
+        const float w = e.halfWidth * tightness, h = e.halfHeight * tightness;
+        return {p.x - w, p.y - h, w * 2.0f, h * 2.0f};
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    double nanosecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    size_t repeatsFor(size_t count, size_t targetOps) {
+        return std::max<size_t>(1, targetOps / count);
+    }
+
+    volatile float g_sink = 0.0f;
+    volatile size_t g_hits = 0;
+
+    // Spawn order is shuffled so the three types interleave in memory, like
+    // objects acquired from separate pools over a session
+    enum class Kind { Bullet, Enemy, Particle };
+
+    std::vector<Kind> makeScene(size_t count, std::mt19937& rng) {
+        std::vector<Kind> kinds;
+        kinds.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            // Roughly the in-game mix: mostly particles, then bullets, few enemies
+            const size_t slot = i % 8;
+            kinds.push_back(slot < 5 ? Kind::Particle : slot < 7 ? Kind::Bullet : Kind::Enemy);
+        }
+        std::shuffle(kinds.begin(), kinds.end(), rng);
+        return kinds;
+    }
+
+    struct Results {
+        double update;      // ns per entity
+        double collide;     // ns per bullet/enemy pair
+    };
+
+    Results benchVirtual(const std::vector<Kind>& kinds, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(0.0f, 1920.0f), vel(-200.0f, 200.0f);
+        std::vector<std::unique_ptr<Object>> storage;
+        std::vector<Object*> bullets, enemies, particles;   // Homogeneous lists, as Game kept them
+        for (Kind kind : kinds) {
+            std::unique_ptr<Object> object;
+            switch (kind) {
+                case Kind::Bullet: object = std::make_unique<VirtualBullet>(); bullets.push_back(object.get()); break;
+                case Kind::Enemy: object = std::make_unique<VirtualEnemy>(); enemies.push_back(object.get()); break;
+                case Kind::Particle: object = std::make_unique<VirtualParticle>(); particles.push_back(object.get()); break;
+            }
+            object->place(pos(rng), pos(rng), vel(rng), vel(rng));
+            storage.push_back(std::move(object));
+        }
+
+        Results results{};
+        const size_t repeats = repeatsFor(kinds.size(), 20'000'000);
+        auto start = Clock::now();
+        for (size_t r = 0; r < repeats; ++r) {
+            for (Object* b : bullets) b->update(0.016f);
+            for (Object* e : enemies) e->update(0.016f);
+            for (Object* p : particles) p->update(0.016f);
+        }
+        results.update = nanosecondsSince(start) / static_cast<double>(repeats * kinds.size());
+
+        const size_t pairs = std::max<size_t>(1, bullets.size() * enemies.size());
+        const size_t collideRepeats = repeatsFor(pairs, 20'000'000);
+        size_t hits = 0;
+        start = Clock::now();
+        for (size_t r = 0; r < collideRepeats; ++r) {
+            for (const Object* b : bullets) {
+                for (const Object* e : enemies) {
+                    hits += intersects(b->getBounds(), e->getBounds());
+                }
+            }
+        }
+        results.collide = nanosecondsSince(start) / static_cast<double>(collideRepeats * pairs);
+
+        float sum = 0.0f;
+        for (const auto& object : storage) sum += object->x();
+        g_sink = g_sink + sum;
+        g_hits = g_hits + hits;
+        return results;
+    }
+
+    Results benchVariant(const std::vector<Kind>& kinds, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(0.0f, 1920.0f), vel(-200.0f, 200.0f);
+        std::vector<AnyEntity> entities;
+        entities.reserve(kinds.size());
+        for (Kind kind : kinds) {
+            const float x = pos(rng), y = pos(rng), vx = vel(rng), vy = vel(rng);
+            switch (kind) {
+                case Kind::Bullet: entities.emplace_back(PlainBullet{x, y, vx, vy}); break;
+                case Kind::Enemy: entities.emplace_back(PlainEnemy{x, y, vx, vy}); break;
+                case Kind::Particle: entities.emplace_back(PlainParticle{x, y, vx, vy, 0.0f}); break;
+            }
+        }
+        // Group by alternative so each loop below is a homogeneous batch
+        std::stable_sort(entities.begin(), entities.end(),
+                         [](const AnyEntity& a, const AnyEntity& b) { return a.index() < b.index(); });
+        const auto firstEnemy = std::find_if(entities.begin(), entities.end(),
+                                             [](const AnyEntity& e) { return e.index() == 1; });
+        const auto firstParticle = std::find_if(entities.begin(), entities.end(),
+                                                [](const AnyEntity& e) { return e.index() == 2; });
+
+        Results results{};
+        const size_t repeats = repeatsFor(kinds.size(), 20'000'000);
+        auto start = Clock::now();
+        for (size_t r = 0; r < repeats; ++r) {
+            for (AnyEntity& entity : entities) {
+                std::visit([](auto& e) { e.update(0.016f); }, entity);
+            }
+        }
+        results.update = nanosecondsSince(start) / static_cast<double>(repeats * kinds.size());
+
+        const auto bulletCount = static_cast<size_t>(firstEnemy - entities.begin());
+        const auto enemyCount = static_cast<size_t>(firstParticle - firstEnemy);
+        const size_t pairs = std::max<size_t>(1, bulletCount * enemyCount);
+        const size_t collideRepeats = repeatsFor(pairs, 20'000'000);
+        size_t hits = 0;
+        start = Clock::now();
+        for (size_t r = 0; r < collideRepeats; ++r) {
+            for (auto b = entities.begin(); b != firstEnemy; ++b) {
+                const Box bulletBox = std::get<PlainBullet>(*b).bounds();
+                for (auto e = firstEnemy; e != firstParticle; ++e) {
+                    hits += intersects(bulletBox, std::get<PlainEnemy>(*e).bounds());
+                }
+            }
+        }
+        results.collide = nanosecondsSince(start) / static_cast<double>(collideRepeats * pairs);
+
+        float sum = 0.0f;
+        for (const AnyEntity& entity : entities) {
+            sum += std::visit([](const auto& e) { return e.x; }, entity);
+        }
+        g_sink = g_sink + sum;
+        g_hits = g_hits + hits;
+        return results;
+    }
+
+    Results benchWorld(const std::vector<Kind>& kinds, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(0.0f, 1920.0f), vel(-200.0f, 200.0f);
+        World world;
+        size_t bulletCount = 0, enemyCount = 0;
+        for (Kind kind : kinds) {
+            const Position p{pos(rng), pos(rng)};
+            const Speed v{vel(rng), vel(rng)};
+            switch (kind) {
+                case Kind::Bullet: world.create(p, v, Extent{2.0f, 2.0f}, BulletTag{true}); bulletCount++; break;
+                case Kind::Enemy: world.create(p, v, Extent{20.0f, 20.0f}, EnemyTag{0.8f}); enemyCount++; break;
+                case Kind::Particle: world.create(p, v, ParticleAge{0.0f}); break;
+            }
+        }
+
+        Results results{};
+        const size_t repeats = repeatsFor(kinds.size(), 20'000'000);
+        auto start = Clock::now();
+        for (size_t r = 0; r < repeats; ++r) {
+            world.each<Position, Speed>([](Position& p, const Speed& v) {
+                p.x += v.x * 0.016f;
+                p.y += v.y * 0.016f;
+            });
+            world.each<ParticleAge>([](ParticleAge& a) { a.age += 0.016f; });
+        }
+        results.update = nanosecondsSince(start) / static_cast<double>(repeats * kinds.size());
+
+        const size_t pairs = std::max<size_t>(1, bulletCount * enemyCount);
+        const size_t collideRepeats = repeatsFor(pairs, 20'000'000);
+        size_t hits = 0;
+        start = Clock::now();
+        for (size_t r = 0; r < collideRepeats; ++r) {
+            world.each<Position, Extent, BulletTag>([&](const Position& bp, const Extent& be, const BulletTag&) {
+                const Box bulletBox = boxOf(bp, be);
+                world.each<Position, Extent, EnemyTag>([&](const Position& ep, const Extent& ee, const EnemyTag& tag) {
+                    hits += intersects(bulletBox, boxOf(ep, ee, tag.tightness));
+                });
+            });
+        }
+        results.collide = nanosecondsSince(start) / static_cast<double>(collideRepeats * pairs);
+
+        float sum = 0.0f;
+        world.each<Position>([&sum](const Position& p) { sum += p.x; });
+        g_sink = g_sink + sum;
+        g_hits = g_hits + hits;
+        return results;
+    }
+
+    void runSize(size_t count) {
+        std::mt19937 rng(1234);
+        const std::vector<Kind> kinds = makeScene(count, rng);
+
+        const Results virtualResults = benchVirtual(kinds, rng);
+        const Results variantResults = benchVariant(kinds, rng);
+        const Results worldResults = benchWorld(kinds, rng);
+
+        std::printf("%8zu | %10.2f %10.2f %10.2f | %10.2f %10.2f %10.2f\n", count,
+                    virtualResults.update, variantResults.update, worldResults.update,
+                    virtualResults.collide, variantResults.collide, worldResults.collide);
+    }
+}
+
+int main() {
+    std::printf("ns per entity updated, and per bullet/enemy pair tested\n\n");
+    std::printf("%8s | %32s | %32s\n", "", "update (ns/entity)", "collide (ns/pair)");
+    std::printf("%8s | %10s %10s %10s | %10s %10s %10s\n", "entities",
+                "virtual", "variant", "world", "virtual", "variant", "world");
+
+    for (size_t count : {size_t{1'000}, size_t{10'000}, size_t{100'000}}) {
+        runSize(count);
+    }
+    return 0;
+}
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include "Config.hpp"
+#include "Handle.hpp"
+
+/**
+ * @brief How a pool reacts when acquire() finds no free object
+ */
+enum class PoolGrowth {
+    Fixed,      // Never grow; acquire() returns nullptr when empty
+    Linear,     // Add one chunk at a time
+    Geometric   // Double the capacity (rounded up to whole chunks)
+};
+
+struct PoolGrowthPolicy {
+    PoolGrowth mode = PoolGrowth::Linear;
+    size_t maxCapacity = 0;   // Hard cap on live objects, 0 = unbounded (storage rounds up to whole chunks)
+};
+
+/**
+ * @brief Object pool backed by fixed-size chunks
+ *
+ * Objects live in chunks that are never moved or freed while the pool exists,
+ * so pointers handed out by acquire() stay valid across growth. Every slot
+ * also carries a generation that is bumped on release, so a Handle<T> from
+ * acquireHandle() resolves in O(1) and stops resolving once its object is
+ * recycled.
+ */
+template<typename T>
+class ObjectPool {
+public:
+    using HandleType = Handle<T>;
+
+    struct Statistics {
+        size_t totalAllocated = 0;
+        size_t currentActive = 0;
+        size_t peakActive = 0;
+        size_t totalAcquired = 0;
+        size_t totalReleased = 0;
+        size_t chunkCount = 0;
+        size_t growthEvents = 0;     // Times acquire() had to allocate
+        size_t failedAcquires = 0;   // Requests refused by policy or hard cap
+    };
+
+    static constexpr size_t MaxSlots = size_t{HandleType::MaxIndex} + 1;
+
+private:
+    std::vector<std::unique_ptr<T[]>> m_chunks;
+    std::vector<uint32_t> m_available;       // Free slot indices
+    std::vector<uint16_t> m_generations;     // One per slot, never 0
+    size_t m_chunkSize = Config::PoolChunkSize;
+    uint32_t m_chunkShift = 0;               // Chunk sizes are powers of two
+    PoolGrowthPolicy m_policy;
+    Statistics m_stats;
+
+public:
+    // chunkSize is rounded up to a power of two so slot lookup is a shift and a mask
+    void initialize(size_t count, size_t chunkSize = Config::PoolChunkSize, PoolGrowthPolicy policy = {}) {
+        GAME_ASSERT(count > 0, "Pool size must be greater than 0");
+        GAME_ASSERT(chunkSize > 0 && chunkSize <= MaxSlots, "Pool chunk size out of range");
+        GAME_ASSERT(m_chunks.empty(), "Pool already initialized");
+
+        m_chunkSize = std::bit_ceil(chunkSize);
+        m_chunkShift = static_cast<uint32_t>(std::countr_zero(m_chunkSize));
+        m_policy = policy;
+        reserve(count);
+    }
+
+    // Grow the pool to hold at least `count` objects (limited by the hard cap).
+    // Safe while objects are checked out. Never shrinks.
+    void reserve(size_t count) {
+        if (m_policy.maxCapacity > 0) {
+            count = std::min(count, m_policy.maxCapacity);
+        }
+        count = std::min(count, MaxSlots);
+        while (capacity() < count) {
+            addChunk();
+        }
+    }
+
+    void setGrowthPolicy(const PoolGrowthPolicy& policy) noexcept { m_policy = policy; }
+
+    // Returns a null handle when the pool is exhausted
+    [[nodiscard]] HandleType acquireHandle() noexcept {
+        const bool atCap = m_policy.maxCapacity > 0 && m_stats.currentActive >= m_policy.maxCapacity;
+        if (atCap || (m_available.empty() && !grow())) {
+            m_stats.failedAcquires++;
+            return HandleType{};
+        }
+
+        const uint32_t index = m_available.back();
+        m_available.pop_back();
+
+        m_stats.currentActive++;
+        m_stats.totalAcquired++;
+        m_stats.peakActive = std::max(m_stats.peakActive, m_stats.currentActive);
+
+        return HandleType(index, m_generations[index]);
+    }
+
+    [[nodiscard]] T* acquire() noexcept {
+        return get(acquireHandle());
+    }
+
+    // nullptr for null handles and for handles whose object was released
+    [[nodiscard]] T* get(HandleType handle) noexcept {
+        return isValid(handle) ? &slot(handle.index()) : nullptr;
+    }
+
+    [[nodiscard]] const T* get(HandleType handle) const noexcept {
+        return isValid(handle) ? &slot(handle.index()) : nullptr;
+    }
+
+    [[nodiscard]] bool isValid(HandleType handle) const noexcept {
+        const uint32_t index = handle.index();
+        return !handle.isNull() && index < m_generations.size() &&
+               m_generations[index] == handle.generation();
+    }
+
+    // Handle of an object this pool handed out; linear in the chunk count
+    [[nodiscard]] HandleType handleOf(const T* obj) const noexcept {
+        const std::less<const T*> before;
+        for (size_t chunk = 0; chunk < m_chunks.size(); ++chunk) {
+            const T* first = m_chunks[chunk].get();
+            if (!before(obj, first) && before(obj, first + m_chunkSize)) {
+                const auto index = static_cast<uint32_t>((chunk << m_chunkShift) + static_cast<size_t>(obj - first));
+                return HandleType(index, m_generations[index]);
+            }
+        }
+        return HandleType{};
+    }
+
+    // Stale or null handles are ignored, so double release is harmless
+    void release(HandleType handle) noexcept {
+        if (!isValid(handle)) return;
+
+        const uint32_t index = handle.index();
+        slot(index).reset();
+        retire(index);
+        m_available.push_back(index);
+
+        if (m_stats.currentActive > 0) {
+            m_stats.currentActive--;
+        }
+        m_stats.totalReleased++;
+    }
+
+    void release(T* obj) noexcept {
+        if (obj) {
+            release(handleOf(obj));
+        }
+    }
+
+    // Invalidates every outstanding handle
+    void releaseAll() noexcept {
+        m_available.clear();
+        for (size_t i = capacity(); i-- > 0;) {
+            const auto index = static_cast<uint32_t>(i);
+            slot(index).reset();
+            retire(index);
+            m_available.push_back(index);
+        }
+        m_stats.currentActive = 0;
+    }
+
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+    [[nodiscard]] const PoolGrowthPolicy& getGrowthPolicy() const noexcept { return m_policy; }
+    [[nodiscard]] size_t getAvailableCount() const noexcept { return m_available.size(); }
+    [[nodiscard]] size_t capacity() const noexcept { return m_chunks.size() * m_chunkSize; }
+    [[nodiscard]] size_t getChunkSize() const noexcept { return m_chunkSize; }
+    [[nodiscard]] float getUsageRatio() const noexcept {
+        return m_stats.totalAllocated > 0 ?
+               static_cast<float>(m_stats.currentActive) / static_cast<float>(m_stats.totalAllocated) : 0.0f;
+    }
+
+private:
+    [[nodiscard]] T& slot(uint32_t index) const noexcept {
+        return m_chunks[index >> m_chunkShift][index & (m_chunkSize - 1)];
+    }
+
+    void retire(uint32_t index) noexcept {
+        m_generations[index] = static_cast<uint16_t>(HandleType::nextGeneration(m_generations[index]));
+    }
+
+    // Called from acquireHandle() when the free list is empty
+    bool grow() noexcept {
+        if (m_policy.mode == PoolGrowth::Fixed) return false;
+        if (m_policy.maxCapacity > 0 && capacity() >= m_policy.maxCapacity) return false;
+        if (capacity() + m_chunkSize > MaxSlots) return false;
+
+        size_t chunksToAdd = 1;
+        if (m_policy.mode == PoolGrowth::Geometric && !m_chunks.empty()) {
+            chunksToAdd = m_chunks.size();
+            if (m_policy.maxCapacity > 0) {
+                const size_t remaining = m_policy.maxCapacity - capacity();
+                chunksToAdd = std::min(chunksToAdd, (remaining + m_chunkSize - 1) / m_chunkSize);
+            }
+            chunksToAdd = std::min(chunksToAdd, (MaxSlots - capacity()) / m_chunkSize);
+        }
+
+        // Gameplay treats an exhausted pool as "no object", so allocation
+        // failure degrades the same way instead of escaping acquire()
+        try {
+            for (size_t i = 0; i < chunksToAdd; ++i) {
+                addChunk();
+            }
+        } catch (const std::bad_alloc&) {
+            return !m_available.empty();
+        }
+
+        m_stats.growthEvents++;
+        return true;
+    }
+
+    void addChunk() {
+        // Allocate everything up front so a throw leaves the pool unchanged
+        auto chunk = std::make_unique<T[]>(m_chunkSize);
+        const size_t first = capacity();
+        reserveGeometric(m_chunks, m_chunks.size() + 1);
+        reserveGeometric(m_available, first + m_chunkSize);
+        reserveGeometric(m_generations, first + m_chunkSize);
+
+        m_chunks.push_back(std::move(chunk));
+        m_generations.resize(first + m_chunkSize, 1);
+
+        // Push in reverse so the lowest indices are handed out first
+        for (size_t i = m_chunkSize; i-- > 0;) {
+            m_available.push_back(static_cast<uint32_t>(first + i));
+        }
+
+        m_stats.chunkCount = m_chunks.size();
+        m_stats.totalAllocated = capacity();
+    }
+
+    // reserve() with exact sizes would reallocate on every chunk
+    template<typename Vector>
+    static void reserveGeometric(Vector& vec, size_t required) {
+        if (required > vec.capacity()) {
+            vec.reserve(std::max(required, vec.capacity() * 2));
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,219 @@
+// Compares ObjectPool against ContiguousPool for acquire/release throughput and
+// for iterating live objects after the free lists have been shuffled by churn.
+//
+// Build with -DSPACEDEFENDER_BUILD_BENCHMARKS=ON, then run ./build/PoolBenchmark
+
+#include "ObjectPool.hpp"
+#include "ContiguousPool.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+namespace {
+    // Simulation state only, as a pool of plain data would hold it
+    struct CompactEntity {
+        float x = 0.0f, y = 0.0f;
+        float vx = 1.0f, vy = 0.5f;
+        bool alive = false;
+
+        void reset() noexcept { alive = false; }
+    };
+
+    // Roughly the footprint of a pooled Bullet: hot simulation fields up front,
+    // cold render state behind them
+    struct RenderEntity {
+        float x = 0.0f, y = 0.0f;
+        float vx = 1.0f, vy = 0.5f;
+        bool alive = false;
+        unsigned char renderState[236];
+
+        RenderEntity() {} // Leave render state uninitialized, like a pooled object being reused
+        void reset() noexcept { alive = false; }
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    double nanosecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    size_t repeatsFor(size_t count, size_t targetOps) {
+        return std::max<size_t>(1, targetOps / count);
+    }
+
+    volatile float g_sink = 0.0f;
+
+    // ObjectPool keeps handles in a side list, like Game::m_activeBullets
+    template<typename BenchEntity>
+    struct ObjectPoolHarness {
+        ObjectPool<BenchEntity> pool;
+        std::vector<Handle<BenchEntity>> active;
+
+        ObjectPoolHarness(size_t capacity, size_t chunkSize) {
+            pool.initialize(capacity, chunkSize, {PoolGrowth::Fixed, 0});
+            active.reserve(capacity);
+        }
+
+        void acquire() {
+            const auto handle = pool.acquireHandle();
+            if (BenchEntity* e = pool.get(handle)) {
+                e->alive = true;
+                active.push_back(handle);
+            }
+        }
+
+        void releaseAt(size_t i) {
+            pool.release(active[i]);
+            active[i] = active.back();
+            active.pop_back();
+        }
+
+        size_t size() const { return active.size(); }
+
+        void update(float dt) {
+            for (auto handle : active) {
+                BenchEntity* e = pool.get(handle);
+                e->x += e->vx * dt;
+                e->y += e->vy * dt;
+            }
+        }
+
+        float checksum() const {
+            float sum = 0.0f;
+            for (auto handle : active) sum += pool.get(handle)->x;
+            return sum;
+        }
+    };
+
+    template<typename BenchEntity>
+    struct ContiguousPoolHarness {
+        ContiguousPool<BenchEntity> pool;
+        std::vector<BenchEntity*> handles;   // Only for picking random victims
+
+        explicit ContiguousPoolHarness(size_t capacity) {
+            pool.initialize(capacity);
+            handles.reserve(capacity);
+        }
+
+        void acquire() {
+            if (BenchEntity* e = pool.acquire()) {
+                e->alive = true;
+                handles.push_back(e);
+            }
+        }
+
+        void releaseAt(size_t i) {
+            pool.release(handles[i]);
+            handles[i] = handles.back();
+            handles.pop_back();
+        }
+
+        size_t size() const { return handles.size(); }
+
+        void update(float dt) {
+            pool.forEachActive([dt](BenchEntity& e) {
+                e.x += e.vx * dt;
+                e.y += e.vy * dt;
+            });
+        }
+
+        float checksum() {
+            float sum = 0.0f;
+            pool.forEachActive([&sum](const BenchEntity& e) { sum += e.x; });
+            return sum;
+        }
+    };
+
+    // Fill to capacity, then repeatedly kill and respawn random objects so the
+    // free list hands slots back in a scrambled order
+    template<typename Harness>
+    void churn(Harness& harness, size_t count, std::mt19937& rng) {
+        while (harness.size() < count) harness.acquire();
+        for (size_t round = 0; round < 4; ++round) {
+            for (size_t i = 0; i < count / 2; ++i) {
+                std::uniform_int_distribution<size_t> pick(0, harness.size() - 1);
+                harness.releaseAt(pick(rng));
+            }
+            while (harness.size() < count) harness.acquire();
+        }
+    }
+
+    template<typename Harness>
+    double benchAcquireRelease(Harness& harness, size_t count) {
+        const size_t repeats = repeatsFor(count, 2'000'000);
+        const auto start = Clock::now();
+        for (size_t r = 0; r < repeats; ++r) {
+            for (size_t i = 0; i < count; ++i) harness.acquire();
+            while (harness.size() > 0) harness.releaseAt(harness.size() - 1);
+        }
+        return nanosecondsSince(start) / static_cast<double>(repeats * count * 2);
+    }
+
+    template<typename Harness>
+    double benchIterate(Harness& harness, size_t count) {
+        const size_t repeats = repeatsFor(count, 20'000'000);
+        harness.update(0.016f); // Warm caches and rebuild any lazy index lists
+        const auto start = Clock::now();
+        for (size_t r = 0; r < repeats; ++r) {
+            harness.update(0.016f);
+        }
+        const double ns = nanosecondsSince(start) / static_cast<double>(repeats * count);
+        g_sink = g_sink + harness.checksum();
+        return ns;
+    }
+
+    // Pools are sized for twice the live count, so churn leaves holes
+    template<typename BenchEntity>
+    void runSize(size_t count) {
+        std::mt19937 rng(1234);
+        const size_t capacity = count * 2;
+
+        double perObjectAcquire, chunkedAcquire, contiguousAcquire;
+        double perObjectIterate, chunkedIterate, contiguousIterate;
+
+        {
+            // Chunk size 1 reproduces the old one-heap-allocation-per-object layout
+            ObjectPoolHarness<BenchEntity> harness(capacity, 1);
+            perObjectAcquire = benchAcquireRelease(harness, count);
+            churn(harness, count, rng);
+            perObjectIterate = benchIterate(harness, count);
+        }
+        {
+            ObjectPoolHarness<BenchEntity> harness(capacity, Config::PoolChunkSize);
+            chunkedAcquire = benchAcquireRelease(harness, count);
+            churn(harness, count, rng);
+            chunkedIterate = benchIterate(harness, count);
+        }
+        {
+            ContiguousPoolHarness<BenchEntity> harness(capacity);
+            contiguousAcquire = benchAcquireRelease(harness, count);
+            churn(harness, count, rng);
+            contiguousIterate = benchIterate(harness, count);
+        }
+
+        std::printf("%8zu | %10.2f %10.2f %10.2f | %10.2f %10.2f %10.2f\n", count,
+                    perObjectAcquire, chunkedAcquire, contiguousAcquire,
+                    perObjectIterate, chunkedIterate, contiguousIterate);
+    }
+
+    template<typename BenchEntity>
+    void runTable(const char* name) {
+        std::printf("\n%s (%zu bytes)\n", name, sizeof(BenchEntity));
+        std::printf("%8s | %32s | %32s\n", "", "acquire + release (ns/op)", "iterate (ns/object)");
+        std::printf("%8s | %10s %10s %10s | %10s %10s %10s\n", "objects",
+                    "per-object", "chunked", "contiguous", "per-object", "chunked", "contiguous");
+
+        for (size_t count : {size_t{10}, size_t{1'000}, size_t{100'000}}) {
+            runSize<BenchEntity>(count);
+        }
+    }
+}
+
+int main() {
+    std::printf("ns per acquire/release op, and per live object visited after random churn\n");
+    runTable<CompactEntity>("Compact entity");
+    runTable<RenderEntity>("Entity with render state");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @brief Heap allocation counts per thread, from replaced global operator new/delete
+ *
+ * The hooks are only compiled in with SPACEDEFENDER_TRACK_ALLOCATIONS (the CMake
+ * option of the same name); otherwise isAvailable() is false and every count
+ * stays zero. Counting costs a few thread-local increments per allocation.
+ *
+ * With a sample interval set, every Nth allocation also records its call stack
+ * into a small fixed ring, so finding where allocations come from doesn't
+ * itself allocate.
+ */
+namespace AllocationTracker {
+    struct Counts {
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t bytes = 0;           // Requested by allocations; frees aren't sized
+        
+        [[nodiscard]] Counts operator-(const Counts& other) const noexcept {
+            return {allocations - other.allocations, frees - other.frees, bytes - other.bytes};
+        }
+    };
+    
+    [[nodiscard]] bool isAvailable() noexcept;
+    
+    // Since the calling thread started
+    [[nodiscard]] Counts threadCounts() noexcept;
+    // Every thread since the process started
+    [[nodiscard]] Counts processCounts() noexcept;
+    
+    // Record the stack of every interval-th allocation; 0 stops sampling
+    void setSampleInterval(uint32_t interval) noexcept;
+    
+    // Write up to the newest recorded stacks from thread to stderr, newest last, and forget them all
+    void printSamples(std::thread::id thread, size_t newest = SIZE_MAX);
+    
+    // Allocations made by this thread between construction and counts()
+    class Scope {
+    private:
+        Counts m_start;
+        
+    public:
+        Scope() noexcept : m_start(threadCounts()) {}
+        [[nodiscard]] Counts counts() const noexcept { return threadCounts() - m_start; }
+    };
+}
\ No newline at end of file
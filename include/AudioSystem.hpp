@@ -20,6 +20,9 @@ public:
 
     void setEnabled(bool enabled) noexcept { m_enabled = enabled; }
     [[nodiscard]] bool isEnabled() const noexcept { return m_enabled; }
+    
+    // Bytes of decoded samples in the sound buffers
+    [[nodiscard]] size_t sampleBytes() const noexcept;
 
 private:
     void generateShootSound();
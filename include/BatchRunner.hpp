@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "Config.hpp"
+
+/**
+ * @brief Many headless games in parallel, for balance sweeps and soak runs
+ *
+ * Every game gets its own Simulation and runs at full speed on a worker
+ * thread. Games are played by a BotPlayer from their own seeds, or by the
+ * inputs of a recorded replay, in which case every game repeats the recorded
+ * run from the replay's seed. When all games are done the runner prints
+ * survival time, score, kills by enemy type, ticks per second and the peak
+ * entity counts against the profile's caps.
+ */
+namespace BatchRunner {
+    struct Options {
+        size_t games = 100;
+        uint32_t firstSeed = 1;           // Bot game i plays seed firstSeed + i
+        unsigned int threads = 0;         // 0 uses every hardware thread
+        std::string profile;              // Tuning profile; empty uses the file's choice
+        float aggressiveness = Config::BotAggressiveness;
+        std::string replayPath;           // Drive every game with this replay's inputs instead of the bot
+        uint64_t maxTicks = 60ull * 60 * 10;  // Games still going after this many ticks count as survived
+        uint32_t assetMask = 0xFF;        // Textures treated as loaded; a full install has all of them
+        std::string csvPath;              // One row per game, when set
+    };
+    
+    // 0 once every game has run, 2 if the runtime config, the replay or the CSV file couldn't be used
+    int run(const Options& options);
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Appends raw values to a byte buffer in native layout
+ *
+ * Meant for state snapshots read back by the same build, so there is no
+ * endian or padding conversion; only trivially copyable types are accepted.
+ */
+class BinaryWriter {
+private:
+    std::vector<std::byte>& m_buffer;
+
+public:
+    explicit BinaryWriter(std::vector<std::byte>& buffer) noexcept : m_buffer(buffer) {}
+
+    // Grows the buffer by size bytes and returns them for the caller to fill in
+    std::byte* appendBytes(size_t size) {
+        const size_t offset = m_buffer.size();
+        m_buffer.resize(offset + size);
+        return m_buffer.data() + offset;
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        std::byte* out = appendBytes(size);
+        if (size > 0) {
+            std::memcpy(out, data, size);
+        }
+    }
+
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter only writes trivially copyable types");
+        writeBytes(&value, sizeof(T));
+    }
+
+    // Element count, then the elements
+    template<typename T>
+    void writeVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter only writes trivially copyable types");
+        write(static_cast<uint64_t>(values.size()));
+        writeBytes(values.data(), values.size() * sizeof(T));
+    }
+};
+
+/**
+ * @brief Reads values written by BinaryWriter, with bounds checks
+ *
+ * A read past the end fails and leaves the reader failed; later reads fail
+ * too, so callers can check ok() once at the end.
+ */
+class BinaryReader {
+private:
+    const std::byte* m_cursor;
+    const std::byte* m_end;
+    bool m_ok = true;
+
+public:
+    BinaryReader(const std::byte* data, size_t size) noexcept : m_cursor(data), m_end(data + size) {}
+
+    bool readBytes(void* data, size_t size) noexcept {
+        if (!m_ok || static_cast<size_t>(m_end - m_cursor) < size) {
+            m_ok = false;
+            return false;
+        }
+        if (size > 0) {
+            std::memcpy(data, m_cursor, size);
+        }
+        m_cursor += size;
+        return true;
+    }
+
+    template<typename T>
+    bool read(T& value) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader only reads trivially copyable types");
+        return readBytes(&value, sizeof(T));
+    }
+
+    // Reuses the vector's capacity
+    template<typename T>
+    bool readVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader only reads trivially copyable types");
+        uint64_t count = 0;
+        if (!read(count) || count > remaining() / sizeof(T)) {
+            m_ok = false;
+            return false;
+        }
+        values.resize(static_cast<size_t>(count));
+        return readBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    [[nodiscard]] size_t remaining() const noexcept { return static_cast<size_t>(m_end - m_cursor); }
+    [[nodiscard]] bool ok() const noexcept { return m_ok; }
+};
\ No newline at end of file
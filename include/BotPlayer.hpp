@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include "Config.hpp"
+#include "PlayerSystem.hpp"
+
+class Simulation;
+
+/**
+ * @brief Scripted stand-in for a player, for soak tests and load generation
+ *
+ * decide() reads the simulation and returns the input a player would give this
+ * tick: sidestep enemy bullets headed for the ship, close in on the nearest
+ * enemy and fire continuously. Ships face the way they move, so once in range
+ * the bot aims with a small move toward its target.
+ *
+ * Decisions depend only on the simulation state, so a bot game is as
+ * repeatable as its seed and records as an ordinary replay.
+ */
+class BotPlayer {
+private:
+    float m_aggressiveness;
+    float m_standoff;         // Distance kept from the target
+    float m_dodgeWeight;      // Strength of a full-urgency dodge relative to the approach
+    
+public:
+    // Aggressiveness in [0, 1]: 0 hangs back and dodges early, 1 closes in and trades hits
+    explicit BotPlayer(float aggressiveness = Config::BotAggressiveness) noexcept;
+    
+    // Input for the ship in slot; empty once that ship is destroyed
+    [[nodiscard]] PlayerInput decide(const Simulation& simulation, size_t slot = 0) const;
+    
+    [[nodiscard]] float getAggressiveness() const noexcept { return m_aggressiveness; }
+};
\ No newline at end of file
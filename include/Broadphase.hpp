@@ -0,0 +1,95 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+#include <cstdint>
+#include "World.hpp"
+
+/**
+ * @brief Which pair finder Broadphase uses
+ */
+enum class BroadphaseMode {
+    BruteForce,     // Test every proxy against all later ones with Utils::Simd::overlapping()
+    SortAndSweep    // Sweep along x over proxies kept sorted between frames
+};
+
+struct CollisionPair {
+    Entity first;
+    Entity second;
+};
+
+/**
+ * @brief Finds AABB pairs that may collide
+ *
+ * Each frame, callers add() one box per entity together with a layer bit and a
+ * mask of layers it collides with. findPairs() then reports every overlapping
+ * pair where either side's mask contains the other's layer. Both modes report
+ * the same set; only the order and cost differ.
+ *
+ * Sort-and-sweep keeps its proxies sorted by left edge across frames and
+ * re-sorts with insertion sort, which stays close to linear while objects move
+ * a little per frame. The sweep tests four candidates at a time against a
+ * packed left/right/top/bottom layout with the same strict comparisons as
+ * Utils::rectIntersects().
+ */
+class Broadphase {
+public:
+    struct Statistics {
+        size_t proxies = 0;
+        size_t pairs = 0;
+        size_t overlapTests = 0;     // Candidate boxes compared
+        size_t sortMoves = 0;        // Insertion sort shifts, near 0 for coherent motion
+    };
+
+private:
+    struct Proxy {
+        float left, right, top, bottom;
+        uint32_t layer;
+        uint32_t mask;
+        Entity entity;
+    };
+
+    BroadphaseMode m_mode = BroadphaseMode::SortAndSweep;
+    std::vector<Proxy> m_submitted;     // This frame, in add() order
+    std::vector<sf::FloatRect> m_submittedBoxes;   // Boxes as added, queried by brute force
+    std::vector<Proxy> m_sorted;        // Sweep order, carried over from last frame
+
+    // Entity index -> position in m_submitted + 1, valid when the stamp matches
+    std::vector<uint32_t> m_submittedSlot;
+    std::vector<uint32_t> m_slotStamp;
+    uint32_t m_stamp = 0;
+
+    // Packed copy of the proxies being tested, padded so four-wide loads stay in bounds
+    std::vector<float> m_left, m_right, m_top, m_bottom;
+    std::vector<uint32_t> m_layer, m_mask;
+    std::vector<uint32_t> m_candidates;     // Brute force overlap hits for one proxy
+
+    std::vector<CollisionPair> m_pairs;
+    Statistics m_stats;
+
+public:
+    void setMode(BroadphaseMode mode) noexcept { m_mode = mode; }
+    [[nodiscard]] BroadphaseMode getMode() const noexcept { return m_mode; }
+
+    // Size storage for this many boxes and entity indices up to entityIndices, so frames don't allocate
+    void reserve(size_t proxies, size_t entityIndices);
+
+    // Starts a new frame; proxies not re-added are dropped at the next findPairs()
+    void clear() noexcept;
+    void add(Entity entity, const sf::FloatRect& box, uint32_t layer, uint32_t mask);
+
+    // Valid until the next clear()
+    const std::vector<CollisionPair>& findPairs();
+
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+
+    // Heap bytes held by proxies, slot tables and packed scratch
+    [[nodiscard]] size_t memoryBytes() const noexcept;
+
+private:
+    void findPairsBruteForce();
+    void findPairsSortAndSweep();
+    void mergeIntoSorted();
+    void insertionSort() noexcept;
+    void pack(const std::vector<Proxy>& proxies);
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "World.hpp"
+#include "Components.hpp"
+
+/**
+ * @brief Bullet archetype: Transform, Velocity, Projectile, Collider
+ * plus a SpriteVisual (textured) or ShapeVisual (fallback)
+ */
+namespace BulletSystem {
+    /**
+     * @brief Fire a bullet
+     * @param texture Bullet texture, or nullptr for the geometric fallback
+     */
+    Entity spawn(World& world, const sf::Vector2f& position, const sf::Vector2f& direction, bool isPlayerBullet,
+                 const sf::Texture* texture);
+    
+    // Pre-size both bullet archetypes (textured and fallback)
+    void reserve(World& world, size_t count);
+    
+    // Kill bullets that have left the screen
+    void cullOffscreen(World& world) noexcept;
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include "Config.hpp"
+#include "Utils.hpp"
+
+// Plain-data components stored in World archetype columns. Keep them
+// trivially copyable: no owning members, no SFML drawables.
+//
+// Saves write columns byte for byte, and implicit padding holds whatever the
+// temporary a component was copied from had there. Order members from large to
+// small and fill any gap with a zeroed `padding` member, so equal states save
+// to equal bytes.
+
+enum class EnemyType : uint8_t {
+    BasicEnemy,
+    FastEnemy,
+    HeavyEnemy
+};
+constexpr size_t EnemyTypeCount = 3;
+
+enum class ExplosionType : uint8_t {
+    Small,   // For bullets and small objects
+    Medium,  // For basic enemies
+    Large    // For player and heavy enemies
+};
+
+// Draw order, back to front
+enum class RenderLayer : uint8_t {
+    Explosions,
+    Particles,
+    Enemies,
+    Player,
+    Bullets,
+    Hud,            // Screen-space overlays such as the health bar
+    Overlay,        // Menu and pause screens drawn over everything else
+    Count
+};
+
+struct Transform {
+    sf::Vector2f position{0, 0};
+    float rotation = 0.0f;              // Degrees, logical facing
+};
+
+struct Velocity {
+    sf::Vector2f value{0, 0};
+};
+
+struct Health {
+    float current = 100.0f;
+    float max = 100.0f;
+
+    // Returns true if this hit was the killing blow
+    bool applyDamage(float damage) noexcept {
+        const bool wasAlive = current > 0.0f;
+        current = std::max(0.0f, current - damage);
+        return wasAlive && current <= 0.0f;
+    }
+    [[nodiscard]] float ratio() const noexcept { return max > 0.0f ? current / max : 0.0f; }
+};
+
+struct Weapon {
+    float cooldown = Config::PlayerShootCooldown;
+    float timer = 0.0f;                 // Ready when <= 0
+
+    [[nodiscard]] bool ready() const noexcept { return timer <= 0.0f; }
+    void fire() noexcept { timer = cooldown; }
+};
+
+// Axis-aligned collision box derived from the visual size
+struct Collider {
+    sf::Vector2f size{0, 0};            // Unrotated visual size
+    float tightness = 1.0f;             // Fraction of the visual box that collides
+    bool rotates = false;               // Box follows Transform::rotation
+    sf::Color debugColor = sf::Color::White;
+    uint8_t padding[3]{};
+};
+
+struct PlayerControl {
+    bool wantToShoot = false;
+};
+
+struct EnemyAI {
+    sf::Vector2f direction{1, 0};
+    float speed = 100.0f;
+    float moveTimer = 0.0f;
+    float turnAt = 2.0f;                // moveTimer value at which a new heading is picked
+    float radius = 15.0f;               // Wall bounce radius
+    sf::Color baseColor = sf::Color::Magenta;
+    EnemyType type = EnemyType::BasicEnemy;
+    uint8_t padding[3]{};
+};
+
+struct Projectile {
+    float damage = Config::PlayerDamage;
+    sf::Vector2f lastPosition{0, 0};    // Where the previous collision pass saw it; hits are swept from here
+    bool fromPlayer = true;
+    uint8_t padding[3]{};
+};
+
+struct Explosion {
+    float frameTime = 0.08f;
+    float frameTimer = 0.0f;
+    uint16_t frame = 0;
+    uint16_t totalFrames = 16;
+    uint16_t framesPerRow = 4;
+    uint16_t padding = 0;
+    sf::Vector2i frameSize{64, 64};
+};
+
+struct Particle {
+    float age = 0.0f;
+    float lifetime = Config::ParticleLifetime;
+    sf::Color color = sf::Color::White;
+};
+
+struct SpriteVisual {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect textureRect;
+    sf::Vector2f size{0, 0};            // On-screen size in pixels
+    sf::Color color = sf::Color::White;
+    float rotationOffset = 0.0f;        // Added to Transform::rotation when drawn
+    RenderLayer layer = RenderLayer::Enemies;
+    uint8_t padding[sizeof(void*) - 1]{};
+
+    // Whole texture stretched to size, centred on the entity
+    [[nodiscard]] static SpriteVisual fit(const sf::Texture& texture, sf::Vector2f size, RenderLayer layer,
+                                          float rotationOffset = 0.0f) noexcept {
+        SpriteVisual visual;
+        visual.texture = &texture;
+        visual.textureRect = sf::IntRect({0, 0}, sf::Vector2i(texture.getSize()));
+        visual.size = size;
+        visual.rotationOffset = rotationOffset;
+        visual.layer = layer;
+        return visual;
+    }
+};
+
+// Geometric fallback when a texture is missing
+struct ShapeVisual {
+    enum class Kind : uint32_t { Circle, Ship };   // Four bytes, so radius follows without a gap
+
+    Kind kind = Kind::Circle;
+    float radius = 10.0f;
+    sf::Color fill = sf::Color::White;
+    sf::Color outline = sf::Color::White;
+    float outlineThickness = 0.0f;
+    RenderLayer layer = RenderLayer::Enemies;
+    uint8_t padding[3]{};
+};
+
+// Untightened AABB of the entity's visual box
+[[nodiscard]] inline sf::FloatRect visualBounds(const Transform& transform, const Collider& collider) noexcept {
+    sf::Vector2f extent = collider.size;
+    if (collider.rotates) {
+        const float radians = Utils::degToRad(transform.rotation);
+        const float c = std::abs(std::cos(radians));
+        const float s = std::abs(std::sin(radians));
+        extent = sf::Vector2f(c * collider.size.x + s * collider.size.y,
+                              s * collider.size.x + c * collider.size.y);
+    }
+    return sf::FloatRect(transform.position - extent * 0.5f, extent);
+}
+
+// Box used for hit tests: the visual box shrunk around its centre
+[[nodiscard]] inline sf::FloatRect collisionBounds(const Transform& transform, const Collider& collider) noexcept {
+    const sf::FloatRect visual = visualBounds(transform, collider);
+    const sf::Vector2f tightSize = visual.size * collider.tightness;
+    return sf::FloatRect(visual.position + (visual.size - tightSize) * 0.5f, tightSize);
+}
+
+/**
+ * @brief Cached boxes for an entity with a Collider
+ *
+ * Rebuilt by refresh() only when the Transform has moved or rotated since the
+ * last build, or when dirty is set (spawn, Collider edits). Readers use the
+ * plain rectangles and never touch trigonometry.
+ */
+struct Bounds {
+    sf::FloatRect visual;
+    sf::FloatRect collision;
+    sf::Vector2f position{0, 0};        // Transform the boxes were built from
+    float rotation = 0.0f;
+    bool dirty = true;
+    uint8_t padding[3]{};
+
+    // Returns true if the boxes were rebuilt
+    bool refresh(const Transform& transform, const Collider& collider) noexcept {
+        if (!dirty && position == transform.position && (rotation == transform.rotation || !collider.rotates)) {
+            return false;
+        }
+
+        visual = visualBounds(transform, collider);
+        const sf::Vector2f tightSize = visual.size * collider.tightness;
+        collision = sf::FloatRect(visual.position + (visual.size - tightSize) * 0.5f, tightSize);
+        position = transform.position;
+        rotation = transform.rotation;
+        dirty = false;
+        return true;
+    }
+};
\ No newline at end of file
@@ -20,6 +20,8 @@ namespace Config {
     constexpr float PlayerShootCooldown = 0.2f;
     constexpr float PlayerBoundsMargin = 20.0f;
     constexpr float PlayerDamage = 25.0f;
+    constexpr size_t MaxPlayers = 2;                // Co-op ships in one game
+    constexpr float CoopSpawnOffset = 100.0f;       // Co-op ships start this far either side of centre
     
     // Enemy Settings
     constexpr size_t MaxEnemies = 3;
@@ -36,15 +38,43 @@ namespace Config {
     // Particle Settings
     constexpr size_t MaxParticles = 500;
     constexpr float ParticleLifetime = 1.0f;
+    constexpr size_t ParticleChunkSize = 128;   // Rows reserved per step under ParticlePolicy = grow
     
     // Pool Sizes
     constexpr size_t BulletPoolSize = 50;
     constexpr size_t ParticlePoolSize = 200;
     constexpr size_t EnemyPoolSize = 10;
+    constexpr size_t PoolChunkSize = 16;      // Objects allocated per pool growth step
     
     // Performance Settings
     constexpr size_t FPSSampleSize = 60;
+    constexpr size_t FrameArenaSize = 512 * 1024;  // Bytes of per-frame scratch; grows once if a frame needs more
+    constexpr unsigned int AllocationWarmupTicks = 300; // Ticks and frames a game may allocate in before --alloc-check
     constexpr float PerformanceUpdateInterval = 1.0f;
+    constexpr const char* MemoryReportPath = "memory_report.txt";  // F2 writes here unless --memory-report is given
+    
+    // Runtime Config Settings (values above are the defaults for every profile)
+    constexpr const char* RuntimeConfigPath = "config/profiles.ini";
+    constexpr const char* DefaultProfile = "default";
+    constexpr float ConfigReloadInterval = 1.0f; // How often the profiles file is checked for edits
+    constexpr unsigned int MaxTargetFPS = 1000;  // Largest TargetFPS a profile may set
+    constexpr size_t MaxEntityBudget = 100000;   // Largest count or pool size a profile may set
+    constexpr float MaxSettingSeconds = 60.0f;   // Largest MaxDeltaTime, cooldown or lifetime a profile may set
+    
+    // Netplay Settings (two-player co-op over UDP)
+    constexpr unsigned short NetplayDefaultPort = 47800;
+    constexpr unsigned int NetplayMaxRollback = 8;     // Ticks a peer may run ahead of the other's inputs
+    constexpr float NetplayTimeout = 5.0f;             // Seconds of silence before the peer counts as gone
+    constexpr float NetplayResendInterval = 0.1f;      // Handshake packets repeat this often
+    
+    // Bot Settings (scripted player for soak tests)
+    constexpr float BotAggressiveness = 0.5f;       // 0 keeps its distance, 1 presses in
+    constexpr float BotMinStandoff = 150.0f;        // Range the most aggressive bot closes to
+    constexpr float BotMaxStandoff = 400.0f;        // Range the most cautious bot closes to
+    constexpr float BotDangerRadius = 60.0f;        // Bullets passing closer than this are dodged
+    constexpr float BotLookahead = 0.75f;           // Seconds ahead a bullet's path is checked
+    constexpr float BotWallMargin = 80.0f;          // Steer away from walls closer than this
+    constexpr float BotAimNudge = 0.05f;            // Move input that turns the ship without moving it far
     
     // Sprite Sizing (all enemies same size as player)
     constexpr float PlayerSpriteSize = 64.0f;     // Base player size in pixels
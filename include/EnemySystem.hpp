@@ -0,0 +1,63 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <random>
+#include <vector>
+#include "World.hpp"
+#include "Components.hpp"
+
+/**
+ * @brief Enemy archetype: Transform, Velocity, Health, Weapon, EnemyAI, Collider
+ * plus a SpriteVisual (textured) or ShapeVisual (fallback)
+ */
+namespace EnemySystem {
+    /**
+     * @brief Create an enemy with the stats for its type
+     * @param texture Ship texture, or nullptr for the geometric fallback
+     */
+    Entity spawn(World& world, const sf::Vector2f& position, EnemyType type, std::mt19937& rng,
+                 const sf::Texture* texture);
+    
+    // Pre-size both enemy archetypes (textured and fallback)
+    void reserve(World& world, size_t count);
+    
+    /**
+     * @brief Structure-of-arrays scratch for update()
+     *
+     * One archetype's enemy state is copied in, processed by loops over plain
+     * float arrays that the compiler vectorizes, and copied back. Keep one
+     * alive across ticks so steady-state updates don't allocate.
+     */
+    struct Batch {
+        std::vector<float> x, y;
+        std::vector<float> dirX, dirY;
+        std::vector<float> speed, radius;
+        std::vector<float> moveTimer, turnAt;
+        std::vector<float> weaponTimer;
+        std::vector<float> rotation;
+        std::vector<float> aimX, aimY, aimAngle;     // Offset to the target and its angle in radians
+        std::vector<uint32_t> firing;     // Row indices whose weapon is ready
+        
+        void resize(size_t rows);
+        [[nodiscard]] size_t memoryBytes() const noexcept;
+    };
+    
+    /**
+     * @brief Batch AI pass, run once per tick after integrateMotion()
+     *
+     * Advances weapon cooldowns and wander timers, bounces off the walls, sets
+     * next tick's Velocity, faces the nearest target and writes the damage tint.
+     * @param targets Positions of the live players; with none, enemies neither turn nor fire
+     * @param shooters Receives enemies whose weapon is ready this tick
+     */
+    void update(World& world, Batch& batch, std::mt19937& rng, const sf::Vector2f* targets, size_t targetCount,
+                float deltaTime, std::vector<Entity>& shooters);
+    
+    // The target an enemy at position faces and shoots at; targetCount must not be 0
+    [[nodiscard]] const sf::Vector2f& nearestTarget(const sf::Vector2f& position, const sf::Vector2f* targets,
+                                                    size_t targetCount) noexcept;
+    
+    [[nodiscard]] sf::Vector2f getShootDirection(const Transform& transform, const sf::Vector2f& target) noexcept;
+    [[nodiscard]] sf::Vector2f getCenteredShootPosition(World& world, Entity enemy, const sf::Vector2f& target) noexcept;
+    [[nodiscard]] int getScoreValue(EnemyType type) noexcept;
+}
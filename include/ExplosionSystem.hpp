@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "World.hpp"
+#include "Components.hpp"
+
+/**
+ * @brief Animated explosion effects using sprite sheet frames
+ *
+ * Each explosion is an entity with Transform, Explosion and SpriteVisual;
+ * update() advances the SpriteVisual's texture rect through the sheet and
+ * destroys the entity after the last frame.
+ */
+class ExplosionSystem {
+private:
+    const sf::Texture* m_explosionTexture = nullptr;
+    
+    // Sprite sheet layout (4x4 frames)
+    static constexpr int FramesPerRow = 4;
+    static constexpr int TotalFrames = 16;
+    
+public:
+    /**
+     * @brief Initialize with the explosion sprite sheet
+     * @param texture 4x4 frame sheet, or nullptr to disable explosions
+     */
+    void initialize(const sf::Texture* texture);
+    
+    /**
+     * @brief Trigger an explosion at the specified position
+     * @param world World to create the explosion entity in
+     * @param position World position for explosion
+     * @param type Type of explosion (affects size and duration)
+     */
+    void createExplosion(World& world, const sf::Vector2f& position, ExplosionType type);
+    
+    // Pre-size the world for this many explosions at once
+    void reserve(World& world, size_t count);
+    
+    /**
+     * @brief Advance all explosion animations
+     * @param world World holding the explosions
+     * @param deltaTime Time elapsed since last update
+     */
+    void update(World& world, float deltaTime) noexcept;
+    
+    [[nodiscard]] bool isEnabled() const noexcept { return m_explosionTexture != nullptr; }
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Bump allocator for data that only lives until the end of a frame
+ *
+ * allocate() hands out the next aligned bytes of one block and reset() makes
+ * the whole block free again, so per-frame scratch never touches the general
+ * heap. A frame that needs more than the block chains extra blocks; the next
+ * reset() replaces them with one block big enough for that frame, so the
+ * arena settles at one allocation and none after.
+ *
+ * Containers using it must be gone before reset(). Not thread-safe: each
+ * thread that wants one keeps its own.
+ */
+class FrameArena {
+public:
+    struct Statistics {
+        size_t capacity = 0;      // Bytes in the main block
+        size_t used = 0;          // Bytes handed out since the last reset()
+        size_t peak = 0;          // Most bytes used by one frame
+        size_t growths = 0;       // Frames that outgrew the block
+    };
+    
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+    
+    Block m_block;
+    std::vector<Block> m_overflow;    // Extra blocks this frame, freed on reset()
+    std::byte* m_top = nullptr;       // Next free byte of the current block
+    std::byte* m_end = nullptr;
+    size_t m_used = 0;
+    size_t m_framePeak = 0;           // Most of m_used this frame, noted before anything is given back
+    Statistics m_stats;
+    
+public:
+    explicit FrameArena(size_t capacity);
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    
+    [[nodiscard]] void* allocate(size_t size, size_t alignment) {
+        std::byte* start = alignUp(m_top, alignment);
+        if (static_cast<size_t>(m_end - start) < size) {
+            return allocateSlow(size, alignment);
+        }
+        m_top = start + size;
+        m_used += size;
+        return start;
+    }
+    
+    // Only the most recent allocation is given back, which is what a growing vector frees
+    void deallocate(void* pointer, size_t size) noexcept {
+        if (static_cast<std::byte*>(pointer) + size == m_top) {
+            m_framePeak = std::max(m_framePeak, m_used);
+            m_top = static_cast<std::byte*>(pointer);
+            m_used -= size;
+        }
+    }
+    
+    // Free everything allocated since the last reset
+    void reset();
+    
+    [[nodiscard]] Statistics getStats() const noexcept;
+    
+private:
+    static std::byte* alignUp(std::byte* pointer, size_t alignment) noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(pointer);
+        return pointer + ((alignment - address % alignment) % alignment);
+    }
+    
+    void* allocateSlow(size_t size, size_t alignment);
+};
+
+// Standard allocator over a FrameArena, for containers that die with the frame
+template<typename T>
+class ArenaAllocator {
+private:
+    FrameArena* m_arena;
+    
+public:
+    using value_type = T;
+    
+    explicit ArenaAllocator(FrameArena& arena) noexcept : m_arena(&arena) {}
+    
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.arena()) {}
+    
+    [[nodiscard]] T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    
+    void deallocate(T* pointer, size_t count) noexcept {
+        m_arena->deallocate(pointer, count * sizeof(T));
+    }
+    
+    [[nodiscard]] FrameArena* arena() const noexcept { return m_arena; }
+    
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.arena(); }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
\ No newline at end of file
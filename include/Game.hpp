@@ -2,22 +2,57 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <vector>
-#include <random>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "GameObject.hpp"
-#include "Player.hpp"
-#include "Enemy.hpp"
-#include "Bullet.hpp"
-#include "ParticleSystem.hpp"
+#include "Simulation.hpp"
+#include "Replay.hpp"
+#include "BotPlayer.hpp"
+#include "NetTransport.hpp"
+#include "RollbackSession.hpp"
+#include "RenderSnapshot.hpp"
+#include "TripleBuffer.hpp"
+#include "Systems.hpp"
+#include "SpriteBatch.hpp"
+#include "FrameArena.hpp"
+#include "AllocationTracker.hpp"
+#include "MemoryReport.hpp"
+#include "Hud.hpp"
+#include "PlayerSystem.hpp"
 #include "AudioSystem.hpp"
 #include "ResourceManager.hpp"
 #include "InputManager.hpp"
 #include "PerformanceMonitor.hpp"
-#include "ObjectPool.hpp"
-#include "ExplosionAnimation.hpp"
+#include "RuntimeConfig.hpp"
+
+enum class GameState {
+    MainMenu,
+    Playing,
+    GameOver,
+    Paused
+};
+
+// Command-line choices for a windowed session
+struct GameOptions {
+    std::string profile;              // Tuning profile; empty uses the file's choice
+    std::string recordPath;           // Record each game to this replay file, replacing the last one
+    std::optional<uint32_t> seed;     // Start every game from this seed instead of a random one
+    std::optional<float> bot;         // Bot aggressiveness; the bot plays in place of the keyboard
+    bool allocationCheck = false;     // Quit with an error if a warmed-up tick or frame allocates
+    std::string memoryReportPath;     // F2 and closing the game write the memory report here
+    
+    // Two-player co-op: the host listens on port, the guest sends to peerAddress:port
+    std::optional<RollbackSession::Role> coop;
+    std::string peerAddress = "127.0.0.1";
+    unsigned short port = Config::NetplayDefaultPort;
+    LinkConditions link;              // Simulated latency and loss, for testing on one machine
+};
 
 class Game {
 private:
@@ -28,36 +63,77 @@ private:
     InputManager m_inputManager;
     AudioSystem m_audioSystem;
     PerformanceMonitor m_performanceMonitor;
+    RuntimeConfig m_runtimeConfig;
+    float m_configReloadTimer = 0.0f;
+    GameOptions m_options;
+    
+    // Gameplay runs on its own thread while playing and hands every tick to the
+    // window thread as a snapshot. The window thread only touches m_simulation
+    // while that thread is stopped.
+    Simulation m_simulation;
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    std::thread m_simulationThread;
+    std::atomic<bool> m_simulationRunning{false};
+    SoundCounters m_playedSounds;     // Counts from the last snapshot whose sounds were played
+    
+    // Input handed to the simulation thread, guarded by m_inputMutex
+    std::mutex m_inputMutex;
+    PlayerInput m_sharedInput;        // Held keys, refreshed every frame
+    bool m_firePressed = false;       // Fire was pressed since the last tick, so quick taps still shoot
+    
+    // Replaces the keyboard on the simulation thread. Outside co-op it starts
+    // the first game and the next one after each game over, for soak runs
+    std::optional<BotPlayer> m_bot;
+    unsigned int m_botGames = 0;
+    
+    std::vector<std::byte> m_quickSave;   // Simulation::save() of the last F5
     
-    // Game objects with pools
-    ObjectPool<Player> m_playerPool;
-    ObjectPool<Enemy> m_enemyPool;
-    ObjectPool<Bullet> m_bulletPool;
-    Player* m_activePlayer = nullptr;
-    std::vector<Enemy*> m_activeEnemies;
-    std::vector<Bullet*> m_activeBullets;
+    // Filled by the simulation thread while a game is recorded. Loads and
+    // settings changes can't be replayed, so they end the recording early.
+    Replay m_recording;
+    bool m_recordingActive = false;
     
-    // Particle and explosion systems
-    std::mt19937 m_rng{std::random_device{}()};
-    ParticleSystem m_particleSystem{m_rng};
-    ExplosionManager m_explosionManager;
+    // Co-op: the session steps m_simulation on the simulation thread in place of step()
+    NetTransport m_transport;
+    std::unique_ptr<RollbackSession> m_netplay;
+    
+    // Everything but the backgrounds, flushed once per frame
+    SpriteBatch m_spriteBatch;
+    
+    // Window-thread scratch that lives for one frame; reset at the end of every run() iteration
+    FrameArena m_frameArena{Config::FrameArenaSize};
+    
+    // Heap use while playing, counted when AllocationTracker is compiled in. The
+    // first Config::AllocationWarmupTicks ticks and frames of a game are left out
+    // of the totals, since pools and buffers are still growing then
+    AllocationTracker::Counts m_frameAllocations;       // Last render()
+    AllocationTracker::Counts m_warmFrameAllocations;   // Since warm-up, this game
+    std::atomic<uint64_t> m_warmTickAllocations{0};     // Written by the simulation thread
+    unsigned int m_gameFrames = 0;
+    std::atomic<bool> m_allocationCheckFailed{false};
+    
+    // Bytes per subsystem, refreshed every run() iteration; the simulation's share comes with each snapshot
+    MemoryReport m_memory;
+    
+    // Menu, pause and game over are frozen screens: render once, then redraw on events
+    sf::RenderTexture m_idleFrame;
+    bool m_idleFrameReady = false;    // Render texture created
+    bool m_idleFrameValid = false;    // Holds the current idle screen
+    bool m_idlePresentPending = true; // An event arrived since the last present
+    GameState m_idleFrameState = GameState::MainMenu;
     
     // Timing
     sf::Clock m_clock;
-    float m_enemySpawnTimer = 0.0f;
-    
-    // Score tracking
-    int m_score = 0;
-    int m_enemiesKilled = 0;
-    int m_previousScore = -1;
-    int m_previousKills = -1;
-    size_t m_previousEnemyCount = 0;
     
-    // UI elements
-    std::unique_ptr<sf::Text> m_scoreText;
-    std::unique_ptr<sf::Text> m_killText;
-    std::unique_ptr<sf::Text> m_enemyCountText;
-    std::unique_ptr<sf::Text> m_fpsText;
+    // UI elements, laid out once in initializeUI()
+    struct HudWidgets {
+        Hud::WidgetId score, kills, enemyCount, fps, debug;
+        Hud::WidgetId titleShadow, title, menu;
+        Hud::WidgetId pause, gameOver, netplay;
+    };
+    Hud m_hud;
+    HudWidgets m_widgets{};
+    TextBuffer m_text;                // Scratch for formatting widget text
     
     // Optimized grid rendering
     sf::VertexArray m_gridLines;
@@ -68,31 +144,50 @@ private:
     bool m_useBackgroundSprite = false;
     bool m_useMainMenuBackground = false;
     
-    // Random distributions
-    std::uniform_real_distribution<float> m_unitDist{0.0f, 1.0f};
-    
 public:
-    Game();
+    explicit Game(const GameOptions& options = {});
+    ~Game();
     void run();
     
+    // False once --alloc-check caught a warmed-up tick or frame allocating
+    [[nodiscard]] bool passedAllocationCheck() const noexcept { return !m_allocationCheckFailed; }
+    
 private:
+    bool openNetplay();
+    void reloadRuntimeConfig(float deltaTime);
+    void applyRuntimeSettings();
     void initializeUI();
     void initializeGrid();
     void handleEvents();
+    void handleEvent(const sf::Event& event);
     void handleKeyPress(sf::Keyboard::Key key);
     void startNewGame();
     void cleanup();
-    void update(float deltaTime);
-    void checkCollisions();
-    void cleanupDeadObjects();
-    void spawnEnemy();
-    void shootBullet();
-    void enemyShoot(Enemy* enemy);
+    void startSimulation();
+    bool stopSimulation();
+    void simulationLoop();
+    void publishSnapshot(const AllocationTracker::Counts& tickAllocations = {});
+    void reportAllocations();
+    void updateMemoryReport();
+    void saveMemoryReport();
+    void shareInput();
+    void requestFire();
+    [[nodiscard]] PlayerInput takeInput();
+    void playSounds(const SoundCounters& sounds);
+    void quickSave();
+    void quickLoad();
+    void beginRecording(uint32_t seed);
+    void finishRecording();
+    void endNetplay();
+    [[nodiscard]] bool isIdleState() const noexcept { return m_currentState != GameState::Playing; }
+    void runIdleFrame();
+    void presentIdleFrame();
     void render();
-    void renderGame();
+    void renderScene(sf::RenderTarget& target);
+    void renderGame(sf::RenderTarget& target);
     void renderUI();
     void renderDebugInfo();
-    void renderMainMenu();
+    void renderMainMenu(sf::RenderTarget& target);
     void renderPauseOverlay();
     void renderGameOver();
 };
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+/**
+ * @brief 32-bit generational reference to a pooled object
+ *
+ * The low bits index a pool slot and the high bits store the slot's generation
+ * at the time the handle was issued. Pools bump the generation on release, so
+ * a stale handle fails lookup instead of dangling. Value 0 is the null handle.
+ */
+template<typename T>
+class Handle {
+public:
+    static constexpr uint32_t IndexBits = 20;                       // Up to ~1M slots per pool
+    static constexpr uint32_t GenerationBits = 32 - IndexBits;      // 4095 reuses before wrap
+    static constexpr uint32_t MaxIndex = (1u << IndexBits) - 1;
+    static constexpr uint32_t GenerationMask = (1u << GenerationBits) - 1;
+
+private:
+    uint32_t m_value = 0;
+
+public:
+    constexpr Handle() noexcept = default;
+    constexpr Handle(uint32_t index, uint32_t generation) noexcept
+        : m_value(((generation & GenerationMask) << IndexBits) | (index & MaxIndex)) {}
+
+    [[nodiscard]] static constexpr Handle fromValue(uint32_t value) noexcept {
+        Handle handle;
+        handle.m_value = value;
+        return handle;
+    }
+
+    [[nodiscard]] constexpr uint32_t index() const noexcept { return m_value & MaxIndex; }
+    [[nodiscard]] constexpr uint32_t generation() const noexcept { return m_value >> IndexBits; }
+    [[nodiscard]] constexpr uint32_t value() const noexcept { return m_value; }
+    [[nodiscard]] constexpr bool isNull() const noexcept { return m_value == 0; }
+    constexpr explicit operator bool() const noexcept { return m_value != 0; }
+
+    constexpr bool operator==(const Handle& other) const noexcept = default;
+
+    // Generation a slot moves to on release; skips 0 so live handles are never null
+    [[nodiscard]] static constexpr uint32_t nextGeneration(uint32_t generation) noexcept {
+        const uint32_t next = (generation + 1) & GenerationMask;
+        return next == 0 ? 1 : next;
+    }
+};
+
+template<typename T>
+struct std::hash<Handle<T>> {
+    size_t operator()(const Handle<T>& handle) const noexcept {
+        return std::hash<uint32_t>{}(handle.value());
+    }
+};
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "SpriteBatch.hpp"
+
+/**
+ * @brief Fixed-capacity text for HUD strings, formatted without allocating
+ *
+ * Text past the capacity is dropped. Numbers go through std::to_chars.
+ */
+class TextBuffer {
+public:
+    static constexpr size_t Capacity = 1024;
+
+private:
+    std::array<char, Capacity> m_chars{};
+    size_t m_size = 0;
+
+public:
+    TextBuffer& clear() noexcept {
+        m_size = 0;
+        return *this;
+    }
+
+    TextBuffer& append(std::string_view text) noexcept {
+        const size_t count = std::min(text.size(), Capacity - m_size);
+        std::copy_n(text.data(), count, m_chars.data() + m_size);
+        m_size += count;
+        return *this;
+    }
+
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    TextBuffer& append(T value) noexcept {
+        const auto result = std::to_chars(m_chars.data() + m_size, m_chars.data() + Capacity, value);
+        if (result.ec == std::errc()) {
+            m_size = static_cast<size_t>(result.ptr - m_chars.data());
+        }
+        return *this;
+    }
+
+    // Fixed-point with `decimals` digits. Built from integer to_chars, since
+    // Apple's libc++ only has the floating-point overloads on newer macOS
+    TextBuffer& append(float value, int decimals) noexcept;
+
+    [[nodiscard]] std::string_view view() const noexcept { return std::string_view(m_chars.data(), m_size); }
+};
+
+/**
+ * @brief Retained text widgets drawn through the SpriteBatch
+ *
+ * Widgets are laid out once with addText(). setText() only marks a widget
+ * dirty when its characters actually change, and a dirty widget rebuilds its
+ * glyph quads on the next draw(). Unchanged widgets resubmit cached vertices,
+ * so a static screen costs a copy per frame and no font lookups. Glyphs live
+ * on the font's page for their character size, so the HUD adds one batch run
+ * per size in use.
+ */
+class Hud {
+public:
+    using WidgetId = size_t;
+
+private:
+    struct Widget {
+        sf::Vector2f position;
+        unsigned int characterSize;
+        sf::Color color;
+        bool bold;
+        RenderLayer layer;
+        std::vector<char> text;
+        std::vector<sf::Vertex> vertices;      // Glyph quads in target coordinates
+        bool dirty = true;
+    };
+
+    const sf::Font* m_font = nullptr;
+    std::vector<Widget> m_widgets;
+    size_t m_rebuilds = 0;
+
+public:
+    // Without a font every widget stays invisible
+    void setFont(const sf::Font* font) noexcept;
+
+    WidgetId addText(const sf::Vector2f& position, unsigned int characterSize, sf::Color color,
+                     RenderLayer layer = RenderLayer::Hud, bool bold = false);
+    void setText(WidgetId widget, std::string_view text);
+
+    void draw(WidgetId widget, SpriteBatch& batch);
+
+    // Widget geometry rebuilds since startup
+    [[nodiscard]] size_t getRebuildCount() const noexcept { return m_rebuilds; }
+
+    // Heap bytes held by widget text and glyph quads
+    [[nodiscard]] size_t memoryBytes() const noexcept;
+    // Texture bytes of the font's glyph pages for the character sizes in use
+    [[nodiscard]] size_t glyphTextureBytes() const;
+
+private:
+    void rebuild(Widget& widget);
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Bytes held per subsystem, current and peak
+ *
+ * Subsystems account for themselves: texture dimensions, sample counts and
+ * container capacities rather than allocator hooks, so a report is available
+ * in every build. An entry is added on its first set() and updated in place
+ * after that, so refreshing a report every frame doesn't allocate. Peaks are
+ * the largest value set, so they are only as fine-grained as the refreshes.
+ */
+class MemoryReport {
+public:
+    enum class Kind : uint8_t {
+        Gpu,        // Texture storage on the graphics card
+        Cpu,        // Pools, buffers and scratch in main memory
+        Audio       // Decoded sample buffers
+    };
+    
+    struct Entry {
+        std::string subsystem;
+        Kind kind;
+        size_t current = 0;
+        size_t peak = 0;
+    };
+    
+private:
+    std::vector<Entry> m_entries;
+    
+public:
+    void set(std::string_view subsystem, Kind kind, size_t bytes);
+    
+    // set() every entry of other at its current value
+    void merge(const MemoryReport& other);
+    
+    [[nodiscard]] const std::vector<Entry>& entries() const noexcept { return m_entries; }
+    [[nodiscard]] size_t total(Kind kind) const noexcept;
+    [[nodiscard]] static const char* kindName(Kind kind) noexcept;
+    
+    // Table of every entry, largest first, with per-kind totals
+    void print(std::FILE* out) const;
+    bool write(const std::string& path) const;
+    
+    // Heap bytes reserved by any number of vectors
+    template<typename... Ts>
+    [[nodiscard]] static size_t capacityBytes(const std::vector<Ts>&... vectors) noexcept {
+        return ((vectors.capacity() * sizeof(Ts)) + ... + size_t{0});
+    }
+};
\ No newline at end of file
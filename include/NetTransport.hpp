@@ -0,0 +1,86 @@
+#pragma once
+
+#include <SFML/Network.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+// Artificial network conditions for outgoing packets, to test netplay on one machine
+struct LinkConditions {
+    float latency = 0.0f;       // Seconds added to every packet
+    float jitter = 0.0f;        // Up to this many more seconds, uniformly random, so packets can reorder
+    float loss = 0.0f;          // Fraction of packets dropped
+};
+
+/**
+ * @brief Non-blocking UDP link to one peer, with a latency and loss shim
+ *
+ * Outgoing packets pass through the shim before they reach the socket, so two
+ * instances on localhost behave like players on a real connection. Packets
+ * come back with their sender, and the caller decides who becomes the peer,
+ * so a stray datagram can't claim the link before a real handshake does.
+ */
+class NetTransport {
+public:
+    struct Statistics {
+        uint64_t sent = 0;
+        uint64_t dropped = 0;           // Lost to the shim
+        uint64_t received = 0;
+        uint64_t bytesSent = 0;
+    };
+    
+    struct Sender {
+        sf::IpAddress address = sf::IpAddress::Any;
+        unsigned short port = 0;
+    };
+    
+private:
+    using Clock = std::chrono::steady_clock;
+    
+    struct Delayed {
+        Clock::time_point sendAt;
+        std::vector<std::byte> data;
+    };
+    
+    sf::UdpSocket m_socket;
+    std::optional<sf::IpAddress> m_peerAddress;
+    unsigned short m_peerPort = 0;
+    
+    LinkConditions m_conditions;
+    std::mt19937 m_rng;                 // Shim only, never gameplay
+    std::vector<Delayed> m_delayed;     // Unsorted; few packets are in flight at once
+    std::vector<std::vector<std::byte>> m_spareBuffers;
+    std::vector<std::byte> m_receiveBuffer;
+    Statistics m_stats;
+    
+public:
+    /**
+     * @brief Bind the local port
+     * @param port Port to listen on, or 0 for any free one
+     * @return True if the socket is bound
+     */
+    bool open(unsigned short port);
+    
+    void setPeer(const sf::IpAddress& address, unsigned short port);
+    [[nodiscard]] bool hasPeer() const noexcept { return m_peerAddress.has_value(); }
+    [[nodiscard]] bool isPeer(const Sender& sender) const noexcept {
+        return m_peerAddress && sender.address == *m_peerAddress && sender.port == m_peerPort;
+    }
+    
+    void setConditions(const LinkConditions& conditions, uint32_t seed = 0);
+    
+    // Queue a packet for the peer; dropped if there is none yet
+    void send(const void* data, size_t size);
+    
+    // Hand packets whose delay has passed to the socket
+    void update();
+    
+    // Next packet from anyone, or false when none is waiting; check isPeer(from) before trusting it
+    bool receive(std::vector<std::byte>& packet, Sender& from);
+    
+    [[nodiscard]] unsigned short getLocalPort() const { return m_socket.getLocalPort(); }
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+};
\ No newline at end of file
@@ -1,33 +1,89 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <vector>
+#include <cstdint>
 #include <random>
+#include <vector>
 #include "Config.hpp"
+#include "World.hpp"
+#include "Components.hpp"
+#include "BinaryStream.hpp"
+#include "MemoryReport.hpp"
+
+// What emit() does when a burst would take the particle count past the budget
+enum class ParticlePolicy : uint8_t {
+    Drop,           // Emit only what fits; the burst loses the rest
+    EvictOldest,    // Retire the oldest (most faded) particles to make room
+    Grow            // Like EvictOldest, but reserve storage a chunk at a time up to the budget
+};
 
+/**
+ * @brief Spark particles stored as World entities
+ *
+ * A particle is Transform + Velocity + Particle + ShapeVisual, so the shared
+ * motion and draw systems move and render it; this class owns emission, fade
+ * and the particle budget.
+ *
+ * Emitted particles are also queued in a ring sized to the budget, oldest
+ * first. Particles share one lifetime and so expire in the same order, which
+ * lets eviction find the oldest live particle by skipping expired entries at
+ * the head: emit() stays O(count) and never reallocates per particle.
+ */
 class ParticleSystem {
 private:
-    struct ParticleData {
-        std::vector<sf::Vector2f> positions;
-        std::vector<sf::Vector2f> velocities;
-        std::vector<sf::Color> colors;
-        std::vector<float> lifetimes;
-        std::vector<float> maxLifetimes;
-        size_t activeCount = 0;
-    } m_particles;
-    
-    sf::VertexArray m_vertices;
+    size_t m_activeCount = 0;
+    size_t m_capacity = Config::MaxParticles;
+    float m_lifetime = Config::ParticleLifetime;
+    ParticlePolicy m_policy = ParticlePolicy::EvictOldest;
+    size_t m_reservedRows = 0;        // World rows reserved so far; only Grow stops short of the budget
+    size_t m_evictions = 0;           // Particles retired early since the last clear()
     std::mt19937& m_rng;
     std::uniform_real_distribution<float> m_angleDist{0, Config::TwoPi};
     std::uniform_real_distribution<float> m_speedDist{100.0f, 300.0f};
     
+    // Emission order ring; entries whose particle already expired are skipped lazily
+    std::vector<Entity> m_order;
+    size_t m_orderHead = 0;           // Oldest entry
+    size_t m_orderCount = 0;
+    
+    // emit() scratch, kept to avoid allocating per burst
+    std::vector<float> m_angles, m_speeds, m_sines, m_cosines;
+    
 public:
     explicit ParticleSystem(std::mt19937& rng);
     
-    void emit(const sf::Vector2f& position, const sf::Color& color, int count) noexcept;
-    void update(float deltaTime) noexcept;
-    void draw(sf::RenderWindow& window) const noexcept;
+    void emit(World& world, const sf::Vector2f& position, const sf::Color& color, int count);
+    void update(World& world, float deltaTime) noexcept;
+    
+    // Forget all particles; call together with World::clear()
     void clear() noexcept;
     
-    [[nodiscard]] size_t getActiveCount() const noexcept { return m_particles.activeCount; }
+    // Particle budget; a lower budget retires the excess on the next update()
+    void setCapacity(size_t capacity);
+    void setLifetime(float lifetime) noexcept { m_lifetime = lifetime; }
+    void setPolicy(ParticlePolicy policy) noexcept { m_policy = policy; }
+    
+    // Room in the world and the emit() scratch for the budget, or for the first chunk of it under Grow
+    void reserve(World& world);
+    
+    // Heap bytes held by the emission ring and emit() scratch; the particles themselves live in the World
+    [[nodiscard]] size_t scratchBytes() const noexcept {
+        return MemoryReport::capacityBytes(m_order, m_angles, m_speeds, m_sines, m_cosines);
+    }
+    
+    // Live count and emission order, part of Simulation::save()
+    void save(BinaryWriter& writer) const;
+    bool load(BinaryReader& reader);
+    
+    [[nodiscard]] size_t getActiveCount() const noexcept { return m_activeCount; }
+    [[nodiscard]] size_t getCapacity() const noexcept { return m_capacity; }
+    [[nodiscard]] ParticlePolicy getPolicy() const noexcept { return m_policy; }
+    [[nodiscard]] size_t getEvictions() const noexcept { return m_evictions; }
+    [[nodiscard]] static const char* policyName(ParticlePolicy policy) noexcept;
+    
+private:
+    void growTo(World& world, size_t rows);
+    void resizeOrder();
+    void track(Entity particle) noexcept;
+    [[nodiscard]] Entity popOldest(const World& world) noexcept;
 };
\ No newline at end of file
@@ -1,12 +1,15 @@
 #pragma once
 
-#include <deque>
+#include <array>
 #include <limits>
 #include "Config.hpp"
 
 class PerformanceMonitor {
 private:
-    std::deque<float> m_frameTimes;
+    // Ring of the last FPSSampleSize frame times; a deque would allocate as it rolls over
+    std::array<float, Config::FPSSampleSize> m_frameTimes{};
+    size_t m_frameTimeCount = 0;
+    size_t m_nextFrameTime = 0;
     float m_accumulatedTime = 0.0f;
     float m_updateTimer = 0.0f;
     float m_currentFPS = 0.0f;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "World.hpp"
+#include "Components.hpp"
+#include "SpriteBatch.hpp"
+
+// One tick of player intent, from the keyboard or anything else steering the ship
+struct PlayerInput {
+    sf::Vector2f move{0.0f, 0.0f};      // Each axis in [-1, 1]; longer vectors are scaled to unit length
+    bool fire = false;
+};
+
+/**
+ * @brief Player archetype: Transform, Health, Weapon, PlayerControl, Collider
+ * plus a SpriteVisual (textured) or ShapeVisual (fallback)
+ */
+namespace PlayerSystem {
+    /**
+     * @brief Create the player entity
+     * @param texture Ship texture, or nullptr for the geometric fallback
+     * @param slot Player number from 0, picks the ship's colours in co-op
+     */
+    Entity spawn(World& world, const sf::Vector2f& position, float shootCooldown, const sf::Texture* texture,
+                 size_t slot = 0);
+    
+    // Weapon cooldown, movement and facing
+    void update(World& world, Entity player, const PlayerInput& input, float deltaTime) noexcept;
+    
+    [[nodiscard]] sf::Vector2f getShootDirection(const Transform& transform) noexcept;
+    [[nodiscard]] sf::Vector2f getShootPosition(World& world, Entity player) noexcept;
+    
+    // Bar in the top-left corner, one row per slot; ratio is the fraction of max health left
+    void drawHealthBar(size_t slot, float ratio, SpriteBatch& batch);
+}
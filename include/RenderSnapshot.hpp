@@ -0,0 +1,108 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Components.hpp"
+#include "Config.hpp"
+#include "World.hpp"
+#include "Broadphase.hpp"
+#include "AllocationTracker.hpp"
+#include "MemoryReport.hpp"
+
+// Sound effects requested since the game started. Counts rather than events,
+// so a renderer that skips snapshots still hears that something happened
+struct SoundCounters {
+    uint32_t shots = 0;
+    uint32_t hits = 0;
+    uint32_t explosions = 0;
+};
+
+/**
+ * @brief Everything the renderer needs from one simulation tick
+ *
+ * Filled by Simulation::capture() and read-only afterwards, so it can be drawn
+ * on another thread while the next tick runs. Holds plain values only; the
+ * textures it points at are owned by the ResourceManager and outlive it.
+ * clear() keeps capacity, so a reused snapshot stops allocating once warm.
+ */
+struct RenderSnapshot {
+    struct Sprite {
+        const sf::Texture* texture;
+        sf::IntRect textureRect;
+        sf::Vector2f position;
+        sf::Vector2f size;
+        float rotation;                 // Degrees, visual offset included
+        sf::Color color;
+        RenderLayer layer;
+    };
+
+    struct Shape {
+        sf::Vector2f position;
+        float rotation;
+        ShapeVisual visual;
+    };
+
+    struct DebugBox {
+        sf::FloatRect box;
+        sf::Color color;
+    };
+
+    uint64_t tick = 0;
+    std::vector<Sprite> sprites;
+    std::vector<Shape> shapes;
+    std::vector<DebugBox> debugBoxes;   // Only filled when Config::ShowDebugBoundaries is set
+
+    // HUD values
+    int score = 0;
+    int enemiesKilled = 0;
+    size_t playerCount = 1;
+    std::array<bool, Config::MaxPlayers> playerAlive{};
+    std::array<float, Config::MaxPlayers> playerHealth{};   // Fraction of max health
+    bool gameOver = false;
+    SoundCounters sounds;
+
+    // Debug overlay values
+    size_t enemies = 0;
+    size_t bullets = 0;
+    size_t particles = 0;
+    size_t particleCapacity = 0;
+    size_t particleEvictions = 0;       // Retired early to make room, this game
+    size_t boundsRebuilt = 0;
+    World::Statistics world;
+    Broadphase::Statistics broadphase;
+    BroadphaseMode broadphaseMode = BroadphaseMode::SortAndSweep;
+    AllocationTracker::Counts tickAllocations;   // Heap use of the tick that produced this snapshot, set by Game
+    MemoryReport memory;                // Simulation subsystems, from Simulation::accountMemory()
+
+    // Co-op rollback values, filled by RollbackSession::capture()
+    struct Netplay {
+        bool active = false;
+        bool connected = false;
+        size_t localSlot = 0;
+        uint32_t rollbackDepth = 0;     // Ticks simulated again for the last tick
+        float resimulationMs = 0.0f;    // Time that took
+        uint32_t maxRollbackDepth = 0;
+        uint64_t stalls = 0;
+    } netplay;
+
+    // Room for this many sprites and shapes; does nothing once there is
+    void reserve(size_t drawables) {
+        sprites.reserve(drawables);
+        shapes.reserve(drawables);
+    }
+
+    [[nodiscard]] size_t memoryBytes() const noexcept {
+        return MemoryReport::capacityBytes(sprites, shapes, debugBoxes);
+    }
+
+    void clear() noexcept {
+        sprites.clear();
+        shapes.clear();
+        debugBoxes.clear();
+    }
+};
\ No newline at end of file
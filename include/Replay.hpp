@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "PlayerSystem.hpp"
+#include "RuntimeConfig.hpp"
+
+// Input and frame time of one Simulation::step()
+struct ReplayFrame {
+    float deltaTime = 0.0f;
+    PlayerInput input;
+};
+
+/**
+ * @brief A recorded game: seed, settings and every tick's input
+ *
+ * The simulation is deterministic for a given seed, settings, set of loaded
+ * textures and input sequence, so feeding the frames back through step()
+ * rebuilds the game exactly. The final tick, score and kills are stored to
+ * catch playback that drifted from the recording.
+ *
+ * Settings are stored field by field and checked on load; the frames are raw
+ * native layout, like Simulation::save(), so a replay is only good for builds
+ * on the same platform.
+ */
+class Replay {
+public:
+    uint32_t seed = 0;
+    RuntimeSettings settings;
+    uint32_t assetMask = 0;           // SimulationAssets::presenceMask() of the recording
+    std::vector<ReplayFrame> frames;
+    
+    uint64_t finalTick = 0;
+    int finalScore = 0;
+    int finalKills = 0;
+    
+    // Bump whenever the file layout or the meaning of a field changes. Versions 1 and 2
+    // stored the settings struct raw; version 1 predates ParticlePolicy and loads with drop
+    static constexpr uint32_t Version = 3;
+    
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+/**
+ * @brief Headless replay playback as a performance regression gate
+ *
+ * Plays a recorded game through the Simulation at full speed with no window,
+ * collects per-phase tick timings and compares them with a baseline file:
+ * @code
+ *   Ticks = 3120              # replay length, guards against a mismatched baseline
+ *   Threshold = 0.10          # allowed slowdown, as a fraction of the baseline
+ *   NoiseFloor = 0.25         # differences under this many us/tick never fail
+ *   Collisions.Threshold = 0.2
+ *   Collisions = 4.81         # us/tick, one line per phase plus Total
+ * @endcode
+ */
+namespace ReplayBenchmark {
+    struct Options {
+        std::string replayPath;
+        std::string baselinePath;     // Compared against, or written when writeBaseline is set
+        bool writeBaseline = false;
+        float threshold = -1.0f;      // Overrides the baseline's Threshold when not negative
+        int repeat = 5;               // Playbacks; each phase keeps its fastest
+        bool allocationCheck = false; // Also fail if a tick after Config::AllocationWarmupTicks allocates
+    };
+    
+    // 0 if every phase is within its threshold, 1 on a regression or a failed allocation check,
+    // 2 if the replay couldn't be checked
+    int run(const Options& options);
+}
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include "MemoryReport.hpp"
 
 class ResourceManager {
 private:
@@ -16,6 +18,7 @@ private:
     
     // Helper methods
     std::string findProjectRoot() const;
+    std::vector<std::string> candidatePaths(const std::string& filePath) const;
     
 public:
     bool loadSystemFont();
@@ -30,6 +33,12 @@ public:
     void loadAllGameTextures();
     void createBackgroundTexture(); // Create procedural space background
     
+    // One GPU entry per texture, named after it, at 4 bytes per pixel
+    void accountMemory(MemoryReport& report) const;
+    
+    // Locate a project-relative data file (same search order as textures)
+    [[nodiscard]] std::string resolvePath(const std::string& filePath) const;
+    
     // Sprite scaling utility
     void scaleTextureToExactSize(sf::Sprite& sprite, float targetWidth, float targetHeight) const;
 };
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Config.hpp"
+#include "NetTransport.hpp"
+#include "RenderSnapshot.hpp"
+#include "RuntimeConfig.hpp"
+#include "Simulation.hpp"
+
+class BinaryReader;
+
+/**
+ * @brief Two-player co-op over a NetTransport with rollback, in the style of GGPO
+ *
+ * Each call to advance() runs one tick. The local input is applied at once.
+ * The remote input is predicted by repeating the peer's last known input. The
+ * state before every unconfirmed tick is kept with Simulation::save(). When
+ * the peer's real input for a tick differs from the prediction, the session
+ * loads that tick's state and simulates forward again to the present before
+ * taking the new tick.
+ *
+ * A peer may get at most Config::NetplayMaxRollback ticks ahead of the
+ * inputs it has from the other. Past that it stalls until they arrive. A peer
+ * that runs further ahead than the other also waits a tick now and then, so
+ * the two stay level.
+ *
+ * Inputs go over the wire as one byte per tick, with each direction reduced
+ * to -1, 0 or 1. Both peers simulate the same bytes, so keyboard play loses
+ * nothing. Every packet repeats all inputs the peer hasn't acknowledged, so
+ * lost packets cost nothing but a later correction.
+ */
+class RollbackSession {
+public:
+    enum class Role : uint8_t {
+        Host,       // Player 1; picks the seed and settings
+        Guest       // Player 2; adopts the host's
+    };
+    
+    struct FrameStats {
+        uint32_t rollbackDepth = 0;         // Ticks loaded back and simulated again this frame
+        double resimulationSeconds = 0.0;   // Load plus the repeated ticks
+        bool stalled = false;               // Too far ahead of the peer's inputs to take a tick
+        bool waited = false;                // Skipped a tick to let a slower peer catch up
+    };
+    
+    struct Totals {
+        uint64_t ticks = 0;
+        uint64_t rollbacks = 0;
+        uint64_t resimulatedTicks = 0;
+        uint64_t stalls = 0;
+        uint64_t waits = 0;
+        uint32_t maxDepth = 0;
+        double resimulationSeconds = 0.0;
+        double maxResimulationSeconds = 0.0;
+        std::array<uint64_t, Config::NetplayMaxRollback + 1> depthCounts{};   // Rollbacks by depth
+    };
+    
+private:
+    using Clock = std::chrono::steady_clock;
+    
+    // Input and state rings, indexed by tick. History also bounds how far apart the peers' ticks can be
+    static constexpr uint32_t History = 64;
+    static constexpr uint32_t StateSlots = Config::NetplayMaxRollback + 1;
+    static_assert(History > 2 * Config::NetplayMaxRollback + 2, "input history must cover both peers' leads");
+    
+    Simulation& m_simulation;
+    NetTransport& m_transport;
+    Role m_role;
+    size_t m_localSlot;
+    size_t m_remoteSlot;
+    
+    bool m_connected = false;
+    bool m_peerLost = false;
+    uint32_t m_seed = 0;                // Also tags packets, so a previous game's can't leak in
+    RuntimeSettings m_settings;
+    float m_deltaTime = 1.0f / Config::TargetFPS;
+    
+    uint32_t m_tick = 0;                // Next tick to simulate
+    uint32_t m_remoteConfirmed = 0;     // Peer inputs received for every tick below this
+    uint32_t m_peerAcked = 0;           // Peer has our inputs for every tick below this
+    uint32_t m_rollbackFrom = UINT32_MAX;   // Earliest tick simulated with a wrong prediction
+    int32_t m_peerLead = 0;             // The peer's last reported lead over our inputs
+    bool m_waitedLastTick = false;
+    
+    std::array<uint8_t, History> m_localInputs{};
+    std::array<uint8_t, History> m_remoteInputs{};
+    std::array<uint8_t, History> m_usedRemoteInputs{};   // What each tick was simulated with
+    std::array<std::vector<std::byte>, StateSlots> m_states;
+    std::vector<std::byte> m_packet;
+    
+    Clock::time_point m_lastHeard;
+    Clock::time_point m_lastHandshake;
+    Clock::time_point m_gameOverAt;
+    bool m_gameOverConfirmed = false;
+    
+    FrameStats m_lastFrame;
+    Totals m_totals;
+    
+public:
+    RollbackSession(Simulation& simulation, NetTransport& transport, Role role);
+    
+    // Host only: the game both peers start once the guest answers
+    void host(uint32_t seed, const RuntimeSettings& settings);
+    
+    // One frame: exchange packets, correct any misprediction and take the next tick if allowed
+    FrameStats advance(const PlayerInput& localInput);
+    
+    // Fill the snapshot's netplay values and hold back gameOver until isFinished()
+    void capture(RenderSnapshot& snapshot) const;
+    
+    // The game ended on both peers (or the peer went silent) and the peer has our last inputs
+    [[nodiscard]] bool isFinished() const noexcept;
+    
+    [[nodiscard]] bool isConnected() const noexcept { return m_connected; }
+    [[nodiscard]] bool isPeerLost() const noexcept { return m_peerLost; }
+    [[nodiscard]] size_t getLocalSlot() const noexcept { return m_localSlot; }
+    [[nodiscard]] const Totals& getTotals() const noexcept { return m_totals; }
+    
+    // Rollback depth and resimulation cost per frame, on one line
+    void printSummary() const;
+    
+    [[nodiscard]] static uint8_t packInput(const PlayerInput& input) noexcept;
+    [[nodiscard]] static PlayerInput unpackInput(uint8_t bits) noexcept;
+    
+private:
+    void receivePackets();
+    void handleInputs(BinaryReader& reader);
+    void handshake();
+    void beginGame();
+    void rollback(FrameStats& stats);
+    void saveState(uint32_t tick);
+    void simulateTick(uint32_t tick);
+    void sendInputs();
+};
\ No newline at end of file
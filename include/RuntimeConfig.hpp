@@ -0,0 +1,94 @@
+#pragma once
+
+#include <string>
+#include <filesystem>
+#include "Config.hpp"
+#include "BinaryStream.hpp"
+#include "Broadphase.hpp"
+#include "ParticleSystem.hpp"
+
+/**
+ * @brief Tuning values that can change without a rebuild
+ *
+ * Every field defaults to its compile-time counterpart in Config.hpp, so a
+ * missing file or an empty profile behaves exactly like the built-in game.
+ */
+struct RuntimeSettings {
+    unsigned int targetFPS = Config::TargetFPS;
+    float maxDeltaTime = Config::MaxDeltaTime;
+
+    size_t maxEnemies = Config::MaxEnemies;
+    float enemySpawnCooldown = Config::EnemySpawnCooldown;
+    size_t maxBullets = Config::MaxBullets;
+    float playerShootCooldown = Config::PlayerShootCooldown;
+
+    size_t maxParticles = Config::MaxParticles;
+    float particleLifetime = Config::ParticleLifetime;
+
+    size_t bulletPoolSize = Config::BulletPoolSize;   // Entity rows reserved up front
+    size_t enemyPoolSize = Config::EnemyPoolSize;
+
+    BroadphaseMode broadphase = BroadphaseMode::SortAndSweep;
+    ParticlePolicy particlePolicy = ParticlePolicy::EvictOldest;   // What a burst does at MaxParticles
+
+    // Field by field at fixed widths, so saved settings don't depend on this struct's layout
+    void save(BinaryWriter& writer) const;
+    // Leaves the settings unchanged if the data runs out; values still need RuntimeConfig::validate()
+    bool load(BinaryReader& reader);
+};
+
+/**
+ * @brief Loads named tuning profiles from an INI-style file and watches it for edits
+ *
+ * File layout:
+ * @code
+ *   profile = default        # active profile (overridden by --profile)
+ *   [low-end]
+ *   TargetFPS = 30
+ *   MaxParticles = 150
+ * @endcode
+ * Keys use the same names as the constants in Config.hpp.
+ */
+class RuntimeConfig {
+private:
+    std::string m_path;
+    std::string m_requestedProfile;   // From the command line; empty means "use the file's choice"
+    std::string m_activeProfile = Config::DefaultProfile;
+    RuntimeSettings m_settings;
+    std::filesystem::file_time_type m_lastWriteTime{};
+    bool m_loaded = false;
+
+public:
+    /**
+     * @brief Load settings from file
+     * @param path Path to the profiles file
+     * @param profile Profile to use; empty selects the file's "profile" key
+     * @return True if the file was read and the profile was found
+     */
+    bool load(const std::string& path, const std::string& profile = "");
+
+    /**
+     * @brief Re-read the file if it changed on disk since the last load
+     * @return True if new settings were loaded
+     */
+    bool reloadIfChanged();
+
+    [[nodiscard]] const RuntimeSettings& getSettings() const noexcept { return m_settings; }
+    [[nodiscard]] const std::string& getActiveProfile() const noexcept { return m_activeProfile; }
+    [[nodiscard]] bool isLoaded() const noexcept { return m_loaded; }
+
+    /**
+     * @brief Clamp settings to their lower bounds and check the upper ones
+     *
+     * Negative cooldowns and zero pool sizes are raised to the smallest usable
+     * value. Values that are not finite or exceed the caps in Config.hpp are
+     * reported on std::cerr and make the whole set invalid, since they would
+     * otherwise reach the simulation's reserve() calls.
+     * @return False if any value is out of range
+     */
+    [[nodiscard]] static bool validate(RuntimeSettings& settings);
+
+private:
+    bool parseFile(RuntimeSettings& settings, std::string& activeProfile) const;
+    static bool applyValue(RuntimeSettings& settings, const std::string& key, const std::string& value);
+};
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Config.hpp"
+#include "World.hpp"
+#include "Components.hpp"
+#include "Broadphase.hpp"
+#include "PlayerSystem.hpp"
+#include "EnemySystem.hpp"
+#include "ExplosionSystem.hpp"
+#include "ParticleSystem.hpp"
+#include "RenderSnapshot.hpp"
+#include "MemoryReport.hpp"
+#include "RuntimeConfig.hpp"
+
+class ResourceManager;
+
+// Textures given to new entities; a nullptr falls back to geometric shapes
+struct SimulationAssets {
+    const sf::Texture* player = nullptr;
+    const sf::Texture* basicEnemy = nullptr;
+    const sf::Texture* fastEnemy = nullptr;
+    const sf::Texture* heavyEnemy = nullptr;
+    const sf::Texture* playerBullet = nullptr;
+    const sf::Texture* enemyBullet = nullptr;
+    const sf::Texture* heavyBullet = nullptr;
+    const sf::Texture* explosion = nullptr;
+    
+    // Every texture the game uses that the resource manager has loaded
+    [[nodiscard]] static SimulationAssets fromResources(const ResourceManager& resources);
+    
+    // One bit per texture that is present. Gameplay only depends on which
+    // textures exist (sprites and shapes have different hit boxes), not on their pixels
+    [[nodiscard]] uint32_t presenceMask() const noexcept;
+    
+    // Empty stand-in textures for the bits in mask, for headless runs that must match a windowed game
+    [[nodiscard]] static SimulationAssets placeholders(uint32_t mask);
+};
+
+/**
+ * @brief Gameplay of one game: entities, spawning, combat and scoring
+ *
+ * Owns no window, audio or input device. step() advances one tick from a
+ * PlayerInput, so the same code runs the windowed game on its simulation
+ * thread and can run headless. Sounds are only counted; capture() copies what
+ * is visible, the HUD values and the counts into a RenderSnapshot.
+ *
+ * save() captures the complete state (entities, RNG, timers, score) as a
+ * versioned binary buffer that load() restores exactly, so a restored
+ * simulation fed the same inputs repeats the original tick for tick.
+ *
+ * Not copyable: the particle system holds a reference to the RNG. Use fork()
+ * for an independent copy.
+ */
+class Simulation {
+public:
+    // One input per player slot; single-player games only read the first
+    using PlayerInputs = std::array<PlayerInput, Config::MaxPlayers>;
+    
+    // Sections of step(), in order, for setProfiling()
+    enum class Phase : uint8_t {
+        Player,
+        Motion,
+        EnemyAI,
+        Effects,          // Bullet culling, particles and explosions
+        Bounds,
+        Collisions,
+        Cleanup,          // Player death and deferred destroys
+        Spawning,
+        Count
+    };
+    
+    struct PhaseTimes {
+        std::array<double, static_cast<size_t>(Phase::Count)> seconds{};
+        uint64_t ticks = 0;
+    };
+    
+private:
+    RuntimeSettings m_settings;
+    SimulationAssets m_assets;
+    
+    // Gameplay entities (players, enemies, bullets, explosions, particles)
+    World m_world;
+    std::array<Entity, Config::MaxPlayers> m_players{};
+    uint32_t m_playerCount = 1;
+    std::array<sf::Vector2f, Config::MaxPlayers> m_targets{};   // Live player positions for the enemy AI
+    uint64_t m_tick = 0;
+    bool m_gameOver = false;
+    
+    // Explosions and particles spawned by hits, applied once collision iteration ends
+    struct ImpactEffect {
+        sf::Vector2f position;
+        int particleCount;
+        sf::Color particleColor;
+        ExplosionType explosion;
+        uint8_t padding[3]{};            // Saved byte for byte, so no implicit padding
+    };
+    std::vector<ImpactEffect> m_pendingEffects;
+    std::vector<Entity> m_shooters;   // Enemies whose weapon is ready this tick
+    EnemySystem::Batch m_enemyBatch;
+    size_t m_boundsRebuilt = 0;       // Cached boxes rebuilt last tick
+    size_t m_entityBudget = 0;        // Most entities the caps allow at once, for reserving storage
+    
+    // Collision: broadphase candidates, then exact swept hits resolved in time order
+    struct BulletHit {
+        float time;                   // Fraction of the bullet's step at first contact
+        Entity bullet;
+        Entity target;
+    };
+    Broadphase m_broadphase;
+    std::vector<BulletHit> m_bulletHits;
+    
+    // Particle and explosion systems
+    std::mt19937 m_rng;
+    std::uniform_real_distribution<float> m_unitDist{0.0f, 1.0f};
+    ParticleSystem m_particleSystem{m_rng};
+    ExplosionSystem m_explosionSystem;
+    
+    float m_enemySpawnTimer = 0.0f;
+    
+    // Score tracking
+    int m_score = 0;
+    int m_enemiesKilled = 0;
+    std::array<int, EnemyTypeCount> m_killsByType{};
+    SoundCounters m_sounds;
+    
+    bool m_profiling = false;
+    PhaseTimes m_phaseTimes;
+    
+public:
+    // Bump whenever the saved layout or the meaning of saved fields changes
+    static constexpr uint32_t SaveVersion = 6;
+    
+    explicit Simulation(uint32_t seed = 0);
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+    
+    void setAssets(const SimulationAssets& assets);
+    
+    // Reserve entity storage and apply caps; lowered caps take effect as entities die off
+    void applySettings(const RuntimeSettings& settings);
+    
+    // Clear the field, reseed and spawn the players and the first enemies. The
+    // seed, player count and the inputs passed to step() fully determine the game
+    void startNewGame(uint32_t seed, size_t playerCount = 1);
+    
+    // Drop every entity; storage stays reserved for the next game
+    void clear();
+    
+    // Advance one tick; does nothing once the game is over. The game ends when every player is dead
+    void step(const PlayerInputs& inputs, float deltaTime);
+    void step(const PlayerInput& input, float deltaTime) { step(PlayerInputs{input}, deltaTime); }
+    
+    void capture(RenderSnapshot& snapshot) const;
+    
+    // Bytes held by the world's archetypes (reserved rows included), the broadphase and per-tick scratch
+    void accountMemory(MemoryReport& report) const;
+    
+    // Append the full state to buffer. Call between ticks
+    void save(std::vector<std::byte>& buffer) const;
+    
+    /**
+     * @brief Replace the state with one written by save()
+     *
+     * Textures are mapped from the saving simulation's assets to this one's.
+     * A buffer from another version or a malformed one leaves the simulation
+     * cleared and returns false.
+     */
+    bool load(const std::byte* data, size_t size);
+    
+    // Independent simulation in the same state, with the same assets
+    [[nodiscard]] std::unique_ptr<Simulation> fork() const;
+    
+    // Accumulate the time step() spends in each Phase; enabling resets the totals
+    void setProfiling(bool enabled) noexcept;
+    [[nodiscard]] const PhaseTimes& getPhaseTimes() const noexcept { return m_phaseTimes; }
+    [[nodiscard]] static const char* phaseName(Phase phase) noexcept;
+    
+    [[nodiscard]] const RuntimeSettings& getSettings() const noexcept { return m_settings; }
+    [[nodiscard]] const SimulationAssets& getAssets() const noexcept { return m_assets; }
+    [[nodiscard]] const World& getWorld() const noexcept { return m_world; }
+    [[nodiscard]] size_t getPlayerCount() const noexcept { return m_playerCount; }
+    [[nodiscard]] Entity getPlayer(size_t slot = 0) const noexcept { return m_players[slot]; }
+    [[nodiscard]] bool isPlayerAlive(size_t slot = 0) const noexcept { return m_world.isAlive(m_players[slot]); }
+    [[nodiscard]] bool isGameOver() const noexcept { return m_gameOver; }
+    [[nodiscard]] uint64_t getTick() const noexcept { return m_tick; }
+    [[nodiscard]] int getScore() const noexcept { return m_score; }
+    [[nodiscard]] int getEnemiesKilled() const noexcept { return m_enemiesKilled; }
+    [[nodiscard]] int getKills(EnemyType type) const noexcept { return m_killsByType[static_cast<size_t>(type)]; }
+    [[nodiscard]] const SoundCounters& getSounds() const noexcept { return m_sounds; }
+    
+private:
+    void resetProgress();
+    void checkCollisions();
+    void cleanupDeadObjects();
+    void spawnEnemy();
+    void shootBullet(Entity player);
+    void enemyShoot(Entity enemy, const sf::Vector2f& target);
+    void spawnPendingEffects();
+};
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * C interface for training agents against the game.
+ *
+ * An sd_env owns a batch of independent headless games that advance together:
+ * sd_env_step_batch() applies one action per game and steps all of them one
+ * tick, spread over worker threads, and sd_env_observe() writes one
+ * sd_observation per game into a caller-owned array. Observations and actions
+ * are plain float structs, so a batch can be viewed as a [count, N] float32
+ * array without copying.
+ *
+ * A game that ends (ship destroyed or max_ticks reached) reports done = 1 in
+ * the observation after that step and restarts from a fresh seed on the next
+ * sd_env_step_batch(). Games are deterministic: the same config and actions
+ * give the same observations.
+ *
+ * Functions returning int give SD_OK or a negative SD_ERROR_* code. An sd_env
+ * may be used from one thread at a time.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#define SD_API __declspec(dllexport)
+#else
+#define SD_API __attribute__((visibility("default")))
+#endif
+
+#define SD_OK 0
+#define SD_ERROR_INVALID_ARGUMENT -1
+#define SD_ERROR_COUNT_MISMATCH -2
+#define SD_ERROR_GAME_FAILED -3  /* A game threw (out of memory, say); reset or destroy the env */
+
+#define SD_OBS_ENEMIES 4    /* Nearest enemies in each observation */
+#define SD_OBS_BULLETS 8    /* Nearest enemy bullets in each observation */
+
+typedef struct sd_env sd_env;
+
+typedef struct sd_env_config {
+    uint32_t num_envs;      /* Games in the batch */
+    uint32_t seed;          /* Game i starts from seed + i; restarts continue the sequence */
+    uint32_t threads;       /* Worker threads including the caller's; 0 uses every hardware thread */
+    uint32_t max_ticks;     /* Episodes end after this many ticks; 0 for no limit */
+    uint32_t asset_mask;    /* Textures treated as loaded (hit boxes differ); 0xFF matches a full install */
+    const char* profile;    /* Tuning profile from config_path, or NULL for the built-in settings */
+    /* Profiles file, or NULL to look for config/profiles.ini from the working
+       directory up as the game does; set it when the host runs from elsewhere */
+    const char* config_path;
+} sd_env_config;
+
+typedef struct sd_action {
+    float move_x;           /* Each axis in [-1, 1]; the ship turns to face its movement */
+    float move_y;
+    float fire;             /* Nonzero fires when the weapon is ready */
+} sd_action;
+
+/*
+ * Positions are fractions of the window, offsets are to the player in window
+ * units, velocities are window units per second. Unused enemy and bullet rows
+ * are all zeros; used rows are sorted nearest first and have present = 1.
+ */
+typedef struct sd_observation {
+    float player_x;
+    float player_y;
+    float heading_x;        /* Unit vector the ship faces and fires along */
+    float heading_y;
+    float health;           /* Fraction of max health */
+    float weapon_ready;     /* 1 if the next fire input shoots */
+    struct {
+        float present;
+        float dx, dy;
+        float vx, vy;
+        float health;
+        float type;         /* 0 basic, 1 fast, 2 heavy */
+    } enemies[SD_OBS_ENEMIES];
+    struct {
+        float present;
+        float dx, dy;
+        float vx, vy;
+    } bullets[SD_OBS_BULLETS];
+    float score_delta;      /* Score gained by the last step */
+    float done;             /* 1 if the last step ended the episode */
+    float truncated;        /* 1 if it ended on max_ticks rather than the ship being destroyed */
+    float tick;             /* Ticks into the episode */
+} sd_observation;
+
+#define SD_OBSERVATION_FLOATS (sizeof(sd_observation) / sizeof(float))
+
+/* Defaults: 1 game, seed 1, all hardware threads, no tick limit, full asset mask, built-in settings,
+   profiles found like the game finds them */
+SD_API sd_env_config sd_env_default_config(void);
+
+/* NULL if config is NULL, asks for no games, names a profile that fails to load, or the games can't be created */
+SD_API sd_env* sd_env_create(const sd_env_config* config);
+SD_API void sd_env_destroy(sd_env* env);
+
+SD_API uint32_t sd_env_count(const sd_env* env);
+
+/* Restart every game from its next seed */
+SD_API int sd_env_reset(sd_env* env);
+
+/* One tick for every game; actions holds count == sd_env_count(env) entries */
+SD_API int sd_env_step_batch(sd_env* env, const sd_action* actions, size_t count);
+
+/* Write count == sd_env_count(env) observations, game i to out[i] */
+SD_API int sd_env_observe(const sd_env* env, sd_observation* out, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include "Components.hpp"
+#include "FrameArena.hpp"
+
+/**
+ * @brief Collects a frame's quads and polygons and draws them in few calls
+ *
+ * Callers submit geometry in any order during the frame. flush() stable-sorts
+ * it by RenderLayer, then by texture, and issues one vertex-array draw per run
+ * of equal texture. Most frames come down to one call per texture in use plus
+ * one for untextured shapes.
+ *
+ * Within a layer, items with the same texture keep their submission order.
+ * Items with different textures in one layer may be reordered.
+ */
+class SpriteBatch {
+public:
+    struct Statistics {
+        size_t items = 0;       // Sprites and shapes submitted
+        size_t vertices = 0;
+        size_t drawCalls = 0;
+    };
+
+private:
+    struct Item {
+        uint32_t key;           // Layer in the high bits, texture slot in the low bits
+        uint32_t firstVertex;
+        uint32_t vertexCount;
+    };
+
+    std::vector<sf::Vertex> m_vertices;           // Submission order
+    std::vector<Item> m_items;
+    std::vector<const sf::Texture*> m_textures;   // Slot -> texture, slot 0 is untextured
+    std::vector<sf::Vector2f> m_points;           // drawConvex() scratch
+    Statistics m_stats;
+
+public:
+    SpriteBatch();
+
+    /**
+     * @brief Textured rectangle centred on position
+     * @param size On-screen size; textureRect is stretched to fit
+     * @param rotation Degrees, clockwise like sf::Transformable
+     */
+    void drawSprite(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+                    const sf::Vector2f& size, float rotation, sf::Color color, RenderLayer layer);
+
+    /**
+     * @brief Untextured convex polygon, drawn like an sf::ConvexShape
+     *
+     * Points are local coordinates, rotated about the local origin and then
+     * moved to position. A positive outlineThickness adds an outline outside
+     * the edges.
+     */
+    void drawConvex(const sf::Vector2f* points, size_t count, const sf::Vector2f& position, float rotation,
+                    sf::Color fill, float outlineThickness, sf::Color outline, RenderLayer layer);
+
+    // Axis-aligned filled rectangle in target coordinates
+    void drawRect(const sf::FloatRect& rect, sf::Color fill, RenderLayer layer);
+
+    // Prebuilt triangles in target coordinates, e.g. cached glyph quads
+    void drawTriangles(const sf::Texture* texture, const sf::Vertex* vertices, size_t count, RenderLayer layer);
+
+    // Sort, draw everything submitted since the last flush() and start over. The
+    // draw-order copy of the vertices lives in arena until the frame ends
+    void flush(sf::RenderTarget& target, FrameArena& arena);
+
+    // Counts from the last flush()
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+
+    // Heap bytes held by the submission buffers
+    [[nodiscard]] size_t memoryBytes() const noexcept;
+
+private:
+    uint32_t textureSlot(const sf::Texture* texture);
+    void pushItem(RenderLayer layer, uint32_t slot, size_t firstVertex);
+};
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include "World.hpp"
+#include "Components.hpp"
+#include "SpriteBatch.hpp"
+#include "RenderSnapshot.hpp"
+
+/**
+ * @brief Systems shared by every entity type
+ *
+ * Anything with the right components is picked up automatically, so a new
+ * entity type only needs type-specific logic of its own.
+ */
+namespace Systems {
+    // position += velocity * dt for every entity with Transform and Velocity
+    void integrateMotion(World& world, float deltaTime) noexcept;
+
+    // Rebuild cached Bounds for entities that moved; returns how many were rebuilt
+    size_t updateBounds(World& world) noexcept;
+
+    // Copy SpriteVisual and ShapeVisual entities, and optionally every cached hit box, into the snapshot
+    void capture(const World& world, RenderSnapshot& snapshot, bool debugBounds);
+
+    // Submit a captured frame; the batch orders it by RenderLayer
+    void draw(const RenderSnapshot& snapshot, SpriteBatch& batch);
+
+    // Outline the captured hit boxes
+    void drawDebugBounds(const RenderSnapshot& snapshot, SpriteBatch& batch);
+}
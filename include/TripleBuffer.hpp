@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Lock-free hand-off of the latest value from one producer thread to one consumer thread
+ *
+ * The producer fills back() and publish()es it. The consumer calls update() to
+ * take the newest published value into front(). The third slot sits between
+ * them, so neither side ever waits: the producer overwrites values the
+ * consumer never picked up, and the consumer keeps reading its last value
+ * until a newer one arrives.
+ *
+ * Each side only touches its own slot. When only one thread is running, it may
+ * play both roles.
+ */
+template<typename T>
+class TripleBuffer {
+private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t FreshBit = 0x4;      // Middle slot holds a value the consumer hasn't taken
+
+    std::array<T, 3> m_slots{};
+    std::atomic<uint8_t> m_middle{1};
+    uint8_t m_back = 0;                           // Producer only
+    uint8_t m_front = 2;                          // Consumer only
+
+public:
+    [[nodiscard]] T& back() noexcept { return m_slots[m_back]; }
+
+    // Hand back() to the consumer and get the stale middle slot to fill next
+    void publish() noexcept {
+        m_back = m_middle.exchange(static_cast<uint8_t>(m_back | FreshBit), std::memory_order_acq_rel) & IndexMask;
+    }
+
+    // Take the newest published value, if any; returns true if front() changed
+    bool update() noexcept {
+        if (!(m_middle.load(std::memory_order_relaxed) & FreshBit)) return false;
+        m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    [[nodiscard]] const T& front() const noexcept { return m_slots[m_front]; }
+};
\ No newline at end of file
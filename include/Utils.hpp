@@ -2,6 +2,7 @@
 
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
 #include <cmath>
 #include "Config.hpp"
 
@@ -16,6 +17,8 @@ namespace Utils {
     [[nodiscard]] inline constexpr float lerp(float a, float b, float t) noexcept;
     [[nodiscard]] inline constexpr float clamp(float value, float min, float max) noexcept;
     [[nodiscard]] inline bool rectIntersects(const sf::FloatRect& rect1, const sf::FloatRect& rect2) noexcept;
+    [[nodiscard]] inline bool sweepRect(const sf::FloatRect& moving, const sf::Vector2f& delta,
+                                        const sf::FloatRect& target, float& hitTime) noexcept;
 }
 
 // Inline implementations
@@ -77,4 +80,34 @@ namespace Utils {
         return r1Left < r2Right && r1Right > r2Left &&
                r1Top < r2Bottom && r1Bottom > r2Top;
     }
+    
+    // `moving` is the box at the end of a step that moved it by `delta`. Returns true if
+    // the box overlapped `target` anywhere along the step; hitTime is the first contact
+    // in [0, 1]. A zero delta behaves exactly like rectIntersects().
+    inline bool sweepRect(const sf::FloatRect& moving, const sf::Vector2f& delta,
+                          const sf::FloatRect& target, float& hitTime) noexcept {
+        // Sweep the moving box's corner against the target grown by the moving box's size
+        const sf::Vector2f start = moving.position - delta;
+        float enter = 0.0f;
+        float exit = 1.0f;
+        
+        const auto slab = [&enter, &exit](float origin, float step, float low, float high) {
+            if (step == 0.0f) {
+                return origin > low && origin < high;
+            }
+            float t0 = (low - origin) / step;
+            float t1 = (high - origin) / step;
+            if (t0 > t1) std::swap(t0, t1);
+            enter = std::max(enter, t0);
+            exit = std::min(exit, t1);
+            return enter < exit;
+        };
+        
+        if (!slab(start.x, delta.x, target.position.x - moving.size.x, target.position.x + target.size.x) ||
+            !slab(start.y, delta.y, target.position.y - moving.size.y, target.position.y + target.size.y)) {
+            return false;
+        }
+        hitTime = enter;
+        return true;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Batch math over float columns, dispatched to the best ISA at startup
+ *
+ * Every call processes `count` elements from structure-of-arrays inputs. The
+ * first call picks AVX2, SSE2 or scalar kernels from CPUID, so one binary
+ * runs on any x86-64 CPU and uses wider registers where they exist. Other
+ * architectures use the scalar kernels.
+ *
+ * The x86 kernels do the same operations in the same order without FMA, so
+ * they agree bit for bit; switching ISA never changes gameplay. Single
+ * values are cheaper through the scalar helpers in Utils.hpp.
+ */
+namespace Utils::Simd {
+    enum class Isa {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    [[nodiscard]] Isa activeIsa() noexcept;
+    [[nodiscard]] const char* isaName(Isa isa) noexcept;
+
+    // Force a lower ISA, e.g. to compare kernels; clamped to what the CPU supports.
+    // Returns the ISA now in use. Not thread-safe against calls in flight.
+    Isa selectIsa(Isa requested) noexcept;
+
+    // Scale each (x[i], y[i]) to unit length in place; zero vectors stay zero.
+    // Exact: same result as Utils::normalize()
+    void normalize(float* x, float* y, size_t count) noexcept;
+
+    // Sine and cosine of each angle in radians. Max abs error 1e-7 for |angle| <= 8192
+    void sincos(const float* radians, float* sines, float* cosines, size_t count) noexcept;
+
+    // atan2(y[i], x[i]) in radians within [-pi, pi]. Max abs error 3e-7; (0, 0) gives 0
+    void atan2(const float* y, const float* x, float* radians, size_t count) noexcept;
+
+    /**
+     * @brief Indices of the boxes that overlap `box`
+     *
+     * Boxes are given as edge columns. Uses the same strict comparisons as
+     * Utils::rectIntersects(), so touching edges don't count.
+     * @param indices Receives up to `count` ascending indices
+     * @return Number of indices written
+     */
+    size_t overlapping(const float* left, const float* top, const float* right, const float* bottom, size_t count,
+                       const sf::FloatRect& box, uint32_t* indices) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,364 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include "Config.hpp"
+#include "Handle.hpp"
+#include "BinaryStream.hpp"
+
+struct EntityTag;
+using Entity = Handle<EntityTag>;
+
+using ComponentId = uint32_t;
+using ComponentMask = uint64_t;
+inline constexpr ComponentId MaxComponents = 64;
+
+/**
+ * @brief Assigns each component type a small dense id on first use
+ *
+ * Components must be trivially copyable: archetype moves and column growth
+ * relocate them with memcpy, and no destructor ever runs on them.
+ */
+class ComponentRegistry {
+public:
+    template<typename T>
+    [[nodiscard]] static ComponentId id() {
+        static_assert(std::is_trivially_copyable_v<T>, "Components must be trivially copyable");
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Component alignment exceeds column alignment");
+        static const ComponentId componentId = registerComponent(sizeof(T));
+        return componentId;
+    }
+
+    [[nodiscard]] static size_t sizeOf(ComponentId id);
+    [[nodiscard]] static size_t count();
+
+private:
+    static ComponentId registerComponent(size_t size);
+};
+
+template<typename... Cs>
+[[nodiscard]] ComponentMask componentMask() {
+    return ((ComponentMask{1} << ComponentRegistry::id<Cs>()) | ... | ComponentMask{0});
+}
+
+/**
+ * @brief Rewrites one component type as a world is saved
+ *
+ * encode() runs on the saved copy of each element, never on the live one, so
+ * pointers can be swapped for ids that the loader maps back after load().
+ */
+struct ComponentEncoder {
+    ComponentId component = MaxComponents;   // MaxComponents matches no column
+    void (*encode)(std::byte* element, const void* context) = nullptr;
+    const void* context = nullptr;
+};
+
+/**
+ * @brief All entities that have exactly one set of components
+ *
+ * Each component is a separate contiguous column indexed by row; row i of
+ * every column belongs to entities()[i]. Removal swaps the last row into the
+ * hole, so rows stay dense.
+ */
+class Archetype {
+private:
+    struct Column {
+        ComponentId id;
+        size_t elementSize;
+        std::vector<std::byte> data;
+    };
+
+    static constexpr uint8_t NoColumn = 0xFF;
+
+    ComponentMask m_mask;
+    std::vector<Column> m_columns;
+    std::array<uint8_t, MaxComponents> m_columnIndex;
+    std::vector<Entity> m_entities;
+
+public:
+    static constexpr uint32_t NoEdge = UINT32_MAX;
+
+    // Cached archetype transitions, indexed by component id
+    std::array<uint32_t, MaxComponents> addEdges;
+    std::array<uint32_t, MaxComponents> removeEdges;
+
+    explicit Archetype(ComponentMask mask);
+
+    [[nodiscard]] ComponentMask mask() const noexcept { return m_mask; }
+    [[nodiscard]] size_t size() const noexcept { return m_entities.size(); }
+    [[nodiscard]] const std::vector<Entity>& entities() const noexcept { return m_entities; }
+    [[nodiscard]] bool has(ComponentId id) const noexcept { return m_columnIndex[id] != NoColumn; }
+
+    [[nodiscard]] std::byte* columnData(ComponentId id) noexcept {
+        return has(id) ? m_columns[m_columnIndex[id]].data.data() : nullptr;
+    }
+
+    template<typename T>
+    [[nodiscard]] T* column() noexcept {
+        return std::launder(reinterpret_cast<T*>(columnData(ComponentRegistry::id<T>())));
+    }
+
+    // Appends a row with zeroed components and returns its index
+    uint32_t pushRow(Entity entity);
+
+    // Removes a row by moving the last row into it; returns the entity that moved, if any
+    Entity swapRemove(uint32_t row) noexcept;
+
+    // Copies every component this archetype shares with `from`
+    void copyRow(uint32_t row, Archetype& from, uint32_t fromRow) noexcept;
+
+    void reserve(size_t rows);
+    void clear() noexcept;
+
+    // Heap bytes held by the columns and entity list, including reserved rows
+    [[nodiscard]] size_t capacityBytes() const noexcept;
+
+    // Rows and columns; load() rejects data whose column sizes differ from this build's
+    void save(BinaryWriter& writer, const ComponentEncoder& encoder = {}) const;
+    bool load(BinaryReader& reader);
+};
+
+/**
+ * @brief Archetype-based entity store
+ *
+ * Entities are generational handles; their components live in the archetype
+ * matching their exact component set. Systems call each<Components...>() to
+ * walk every matching archetype column by column. Adding or removing a
+ * component moves the entity's row to another archetype.
+ *
+ * Structural changes (create, destroy, add, remove) are not allowed inside
+ * each(); use destroyLater() there and flush() afterwards.
+ */
+class World {
+public:
+    struct Statistics {
+        size_t entityCount = 0;
+        size_t peakEntities = 0;
+        size_t archetypeCount = 0;
+        size_t archetypeMoves = 0;   // Rows moved by add()/remove()
+    };
+
+private:
+    struct EntityRecord {
+        uint32_t archetype = 0;
+        uint32_t row = 0;
+        uint16_t generation = 1;
+        bool alive = false;
+        bool pendingDestroy = false;
+    };
+
+    // unique_ptr so archetype addresses survive new archetypes being added
+    std::vector<std::unique_ptr<Archetype>> m_archetypes;
+    std::unordered_map<ComponentMask, uint32_t> m_archetypeByMask;
+    std::vector<EntityRecord> m_records;
+    std::vector<uint32_t> m_freeIds;
+    std::vector<Entity> m_pendingDestroy;
+    int m_iterationDepth = 0;
+    Statistics m_stats;
+
+public:
+    World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    template<typename... Cs>
+    Entity create(const Cs&... components) {
+        GAME_ASSERT(m_iterationDepth == 0, "World::create inside each()");
+        const uint32_t archetypeIndex = archetypeFor(componentMask<Cs...>());
+        Archetype& archetype = *m_archetypes[archetypeIndex];
+
+        const Entity entity = allocateEntity();
+        EntityRecord& record = m_records[entity.index()];
+        record.archetype = archetypeIndex;
+        record.row = archetype.pushRow(entity);
+        (::new (archetype.column<Cs>() + record.row) Cs(components), ...);
+        return entity;
+    }
+
+    // Immediate removal; invalidates references into the entity's archetype
+    void destroy(Entity entity);
+
+    // Marks the entity dead now and removes it at the next flush(); safe inside each()
+    void destroyLater(Entity entity);
+    void flush();
+    void clear();
+
+    // False for stale handles and for entities waiting in destroyLater()
+    [[nodiscard]] bool isAlive(Entity entity) const noexcept {
+        return contains(entity) && !m_records[entity.index()].pendingDestroy;
+    }
+
+    // True until the entity's storage is actually released
+    [[nodiscard]] bool contains(Entity entity) const noexcept {
+        const uint32_t index = entity.index();
+        return !entity.isNull() && index < m_records.size() && m_records[index].alive &&
+               m_records[index].generation == entity.generation();
+    }
+
+    template<typename T>
+    [[nodiscard]] T* get(Entity entity) noexcept {
+        if (!contains(entity)) return nullptr;
+        const EntityRecord& record = m_records[entity.index()];
+        T* column = m_archetypes[record.archetype]->column<T>();
+        return column ? column + record.row : nullptr;
+    }
+
+    template<typename T>
+    [[nodiscard]] const T* get(Entity entity) const noexcept {
+        return const_cast<World*>(this)->get<T>(entity);
+    }
+
+    template<typename T>
+    [[nodiscard]] bool has(Entity entity) const noexcept {
+        return get<T>(entity) != nullptr;
+    }
+
+    // Adds or overwrites a component; adding moves the entity to another archetype
+    template<typename T>
+    T& add(Entity entity, const T& component) {
+        if (T* existing = get<T>(entity)) {
+            *existing = component;
+            return *existing;
+        }
+        GAME_ASSERT(contains(entity), "World::add on a dead entity");
+        const ComponentId id = ComponentRegistry::id<T>();
+        const uint32_t row = moveEntity(entity, id, true);
+        T* slot = m_archetypes[m_records[entity.index()].archetype]->column<T>() + row;
+        return *::new (slot) T(component);
+    }
+
+    template<typename T>
+    void remove(Entity entity) {
+        if (has<T>(entity)) {
+            moveEntity(entity, ComponentRegistry::id<T>(), false);
+        }
+    }
+
+    /**
+     * @brief Visit every entity that has all of Cs
+     *
+     * func is called as func(Cs&...) or func(Entity, Cs&...). Archetypes are
+     * visited in creation order and rows in storage order.
+     */
+    template<typename... Cs, typename Func>
+    void each(Func&& func) {
+        eachImpl<Cs...>(*this, func);
+    }
+
+    template<typename... Cs, typename Func>
+    void each(Func&& func) const {
+        eachImpl<const Cs...>(const_cast<World&>(*this), func);
+    }
+
+    /**
+     * @brief Visit every matching archetype as whole columns
+     *
+     * func is called as func(size_t rows, const Entity* entities, Cs*... columns)
+     * once per non-empty archetype, for kernels that process rows in bulk.
+     */
+    template<typename... Cs, typename Func>
+    void eachBatch(Func&& func) {
+        const ComponentMask required = componentMask<Cs...>();
+        const IterationScope scope(*this);
+        for (const auto& archetype : m_archetypes) {
+            if ((archetype->mask() & required) != required || archetype->size() == 0) continue;
+            func(archetype->size(), archetype->entities().data(), archetype->column<Cs>()...);
+        }
+    }
+
+    template<typename... Cs>
+    [[nodiscard]] size_t count() const noexcept {
+        const ComponentMask required = componentMask<Cs...>();
+        size_t total = 0;
+        for (const auto& archetype : m_archetypes) {
+            if ((archetype->mask() & required) == required) {
+                total += archetype->size();
+            }
+        }
+        return total;
+    }
+
+    // Pre-size the archetype holding exactly Cs
+    template<typename... Cs>
+    void reserve(size_t rows) {
+        m_archetypes[archetypeFor(componentMask<Cs...>())]->reserve(rows);
+    }
+
+    // Pre-size the entity table and free lists for this many live entities
+    void reserveEntities(size_t count);
+
+    // Column bytes, reserved rows included, of the archetypes that have all of Cs
+    template<typename... Cs>
+    [[nodiscard]] size_t archetypeBytes() const noexcept {
+        const ComponentMask required = componentMask<Cs...>();
+        size_t total = 0;
+        for (const auto& archetype : m_archetypes) {
+            if ((archetype->mask() & required) == required) {
+                total += archetype->capacityBytes();
+            }
+        }
+        return total;
+    }
+
+    // Entity records, free lists and archetype bookkeeping, without the columns
+    [[nodiscard]] size_t tableBytes() const noexcept;
+
+    [[nodiscard]] const Statistics& getStats() const noexcept { return m_stats; }
+
+    /**
+     * @brief Write every archetype, entity record and free id
+     *
+     * Component ids are assigned on first use, so a saved world only loads
+     * into a process that registered the same components in the same order.
+     * Columns are written as raw bytes apart from the encoder's component.
+     */
+    void save(BinaryWriter& writer, const ComponentEncoder& encoder = {}) const;
+
+    /**
+     * @brief Replace the contents with a saved world
+     *
+     * Archetypes are rebuilt in the saved order, so each() visits entities
+     * exactly as the saved world did; storage of matching archetypes is reused.
+     * On malformed data the world is left empty and false is returned.
+     */
+    bool load(BinaryReader& reader);
+
+private:
+    Entity allocateEntity();
+    uint32_t archetypeFor(ComponentMask mask);
+    uint32_t moveEntity(Entity entity, ComponentId id, bool adding);
+
+    struct IterationScope {
+        World& world;
+        explicit IterationScope(World& w) noexcept : world(w) { ++world.m_iterationDepth; }
+        ~IterationScope() { --world.m_iterationDepth; }
+    };
+
+    template<typename... Cs, typename Func>
+    static void eachImpl(World& world, Func& func) {
+        const ComponentMask required = componentMask<std::remove_const_t<Cs>...>();
+        const IterationScope scope(world);
+        for (const auto& archetype : world.m_archetypes) {
+            if ((archetype->mask() & required) != required || archetype->size() == 0) continue;
+
+            const std::tuple<Cs*...> columns{archetype->column<std::remove_const_t<Cs>>()...};
+            const Entity* entities = archetype->entities().data();
+            const size_t rows = archetype->size();
+            for (size_t row = 0; row < rows; ++row) {
+                if constexpr (std::is_invocable_v<Func&, Entity, Cs&...>) {
+                    func(entities[row], std::get<Cs*>(columns)[row]...);
+                } else {
+                    func(std::get<Cs*>(columns)[row]...);
+                }
+            }
+        }
+    }
+};
\ No newline at end of file
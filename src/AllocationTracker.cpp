@@ -0,0 +1,225 @@
+#include "AllocationTracker.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#if defined(SPACEDEFENDER_TRACK_ALLOCATIONS) && __has_include(<execinfo.h>)
+#include <execinfo.h>
+#include <unistd.h>
+#define SPACEDEFENDER_ALLOCATION_STACKS 1
+#endif
+
+namespace {
+    constexpr size_t SampleSlots = 32;
+    constexpr int SampleFrames = 24;
+    
+    struct Sample {
+        std::thread::id thread;
+        uint64_t size = 0;
+        int depth = 0;
+        std::array<void*, SampleFrames> frames{};
+    };
+    
+    // Plain thread_locals with no constructors, so the hooks can touch them at any time
+    thread_local AllocationTracker::Counts t_counts;
+    
+    std::atomic<uint64_t> g_allocations{0};
+    std::atomic<uint64_t> g_frees{0};
+    std::atomic<uint64_t> g_bytes{0};
+    std::atomic<uint32_t> g_sampleInterval{0};
+    
+    std::mutex g_sampleMutex;
+    std::array<Sample, SampleSlots> g_samples;
+    size_t g_sampleCount = 0;         // Samples written, including ones since overwritten
+}
+
+#ifdef SPACEDEFENDER_TRACK_ALLOCATIONS
+namespace {
+    thread_local bool t_inHook = false;
+    
+    void recordSample(size_t size) {
+#ifdef SPACEDEFENDER_ALLOCATION_STACKS
+        Sample sample;
+        sample.thread = std::this_thread::get_id();
+        sample.size = size;
+        sample.depth = backtrace(sample.frames.data(), SampleFrames);
+        
+        std::lock_guard<std::mutex> lock(g_sampleMutex);
+        g_samples[g_sampleCount++ % SampleSlots] = sample;
+#else
+        (void)size;
+#endif
+    }
+    
+    void countAllocation(size_t size) noexcept {
+        // Allocations made by the hook itself, e.g. backtrace() loading its unwinder, aren't counted
+        if (t_inHook) return;
+        t_inHook = true;
+        
+        t_counts.allocations++;
+        t_counts.bytes += size;
+        const uint64_t serial = g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+        
+        const uint32_t interval = g_sampleInterval.load(std::memory_order_relaxed);
+        if (interval > 0 && serial % interval == 0) {
+            try {
+                recordSample(size);
+            } catch (...) {
+            }
+        }
+        t_inHook = false;
+    }
+    
+    void countFree(void* pointer) noexcept {
+        if (!pointer || t_inHook) return;
+        t_counts.frees++;
+        g_frees.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    void* allocate(size_t size, size_t alignment = 0) noexcept {
+        countAllocation(size);
+        if (size == 0) {
+            size = 1;
+        }
+        if (alignment <= alignof(std::max_align_t)) {
+            return std::malloc(size);
+        }
+#ifdef _WIN32
+        // Windows has no posix_memalign, and these blocks must go back through _aligned_free
+        return _aligned_malloc(size, alignment);
+#else
+        void* pointer = nullptr;
+        return posix_memalign(&pointer, alignment, size) == 0 ? pointer : nullptr;
+#endif
+    }
+    
+    void* allocateOrThrow(size_t size, size_t alignment = 0) {
+        void* pointer = allocate(size, alignment);
+        if (!pointer) throw std::bad_alloc();
+        return pointer;
+    }
+    
+    // alignment must match the allocation's, which the aligned delete operators are given
+    void release(void* pointer, size_t alignment = 0) noexcept {
+        countFree(pointer);
+#ifdef _WIN32
+        if (alignment > alignof(std::max_align_t)) {
+            _aligned_free(pointer);
+            return;
+        }
+#else
+        (void)alignment;
+#endif
+        std::free(pointer);
+    }
+}
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+void operator delete[](void* pointer) noexcept { release(pointer); }
+void operator delete(void* pointer, size_t) noexcept { release(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { release(pointer); }
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+void operator delete(void* pointer, size_t, std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+void operator delete[](void* pointer, size_t, std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { release(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { release(pointer); }
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    release(pointer, static_cast<size_t>(alignment));
+}
+#endif
+
+bool AllocationTracker::isAvailable() noexcept {
+#ifdef SPACEDEFENDER_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocationTracker::Counts AllocationTracker::threadCounts() noexcept {
+    return t_counts;
+}
+
+AllocationTracker::Counts AllocationTracker::processCounts() noexcept {
+    return {g_allocations.load(std::memory_order_relaxed), g_frees.load(std::memory_order_relaxed),
+            g_bytes.load(std::memory_order_relaxed)};
+}
+
+void AllocationTracker::setSampleInterval(uint32_t interval) noexcept {
+#ifdef SPACEDEFENDER_ALLOCATION_STACKS
+    // The first backtrace() may load the unwinder; do that now rather than inside a sampled allocation
+    static const bool warmed = [] {
+        std::array<void*, 1> frame{};
+        return backtrace(frame.data(), 1) >= 0;
+    }();
+    (void)warmed;
+#endif
+    g_sampleInterval.store(interval, std::memory_order_relaxed);
+}
+
+void AllocationTracker::printSamples(std::thread::id thread, size_t newest) {
+    std::array<Sample, SampleSlots> samples;
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_sampleMutex);
+        samples = g_samples;
+        count = g_sampleCount;
+        g_sampleCount = 0;
+    }
+    
+    // Walk back to the oldest of the newest samples from thread
+    size_t first = count;
+    const size_t oldest = count > SampleSlots ? count - SampleSlots : 0;
+    for (size_t matched = 0; first > oldest && matched < newest; ) {
+        --first;
+        if (samples[first % SampleSlots].thread == thread) ++matched;
+    }
+    
+    for (size_t i = first; i < count; ++i) {
+        const Sample& sample = samples[i % SampleSlots];
+        if (sample.thread != thread) continue;
+        std::fprintf(stderr, "Allocation of %llu bytes:\n", static_cast<unsigned long long>(sample.size));
+        std::fflush(stderr);
+#ifdef SPACEDEFENDER_ALLOCATION_STACKS
+        backtrace_symbols_fd(sample.frames.data(), sample.depth, STDERR_FILENO);
+#endif
+    }
+}
@@ -28,6 +28,14 @@ void AudioSystem::playHit() noexcept {
     if (m_enabled) playSound(m_hitBuffer); 
 }
 
+size_t AudioSystem::sampleBytes() const noexcept {
+    size_t samples = 0;
+    for (const sf::SoundBuffer* buffer : {&m_shootBuffer, &m_explosionBuffer, &m_hitBuffer}) {
+        samples += static_cast<size_t>(buffer->getSampleCount());
+    }
+    return samples * sizeof(std::int16_t);
+}
+
 void AudioSystem::generateShootSound() {
     constexpr unsigned sampleRate = 44100;
     constexpr float duration = 0.1f;
@@ -0,0 +1,254 @@
+#include "BatchRunner.hpp"
+#include "BotPlayer.hpp"
+#include "Replay.hpp"
+#include "ResourceManager.hpp"
+#include "RuntimeConfig.hpp"
+#include "Simulation.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct GameResult {
+        uint32_t seed = 0;
+        uint64_t ticks = 0;
+        float survivalSeconds = 0.0f;     // Game time until the ship was destroyed
+        bool survived = false;            // Still alive at maxTicks or when the replay's inputs ran out
+        int score = 0;
+        std::array<int, EnemyTypeCount> kills{};
+        double wallSeconds = 0.0;
+        
+        // Most entities of each kind alive at once
+        size_t peakEnemies = 0;
+        size_t peakBullets = 0;
+        size_t peakParticles = 0;
+        size_t peakExplosions = 0;
+    };
+    
+    const char* enemyName(size_t type) noexcept {
+        switch (static_cast<EnemyType>(type)) {
+            case EnemyType::BasicEnemy: return "Basic";
+            case EnemyType::FastEnemy: return "Fast";
+            case EnemyType::HeavyEnemy: return "Heavy";
+        }
+        return "?";
+    }
+    
+    // Run one game on this thread; the simulation is reused between games
+    void play(Simulation& simulation, const BatchRunner::Options& options, const RuntimeSettings& settings,
+              const Replay* replay, uint32_t seed, GameResult& result) {
+        simulation.startNewGame(seed);
+        const World& world = simulation.getWorld();
+        const BotPlayer bot(options.aggressiveness);
+        const unsigned int tickRate = settings.targetFPS > 0 ? settings.targetFPS : Config::TargetFPS;
+        const float tickLength = 1.0f / static_cast<float>(tickRate);
+        const uint64_t tickLimit = replay ? std::min<uint64_t>(replay->frames.size(), options.maxTicks)
+                                          : options.maxTicks;
+        
+        float gameSeconds = 0.0f;
+        const auto start = std::chrono::steady_clock::now();
+        while (!simulation.isGameOver() && simulation.getTick() < tickLimit) {
+            if (replay) {
+                const ReplayFrame& frame = replay->frames[simulation.getTick()];
+                simulation.step(frame.input, frame.deltaTime);
+                gameSeconds += std::min(frame.deltaTime, settings.maxDeltaTime);
+            } else {
+                simulation.step(bot.decide(simulation), tickLength);
+                gameSeconds += tickLength;
+            }
+            
+            result.peakEnemies = std::max(result.peakEnemies, world.count<EnemyAI>());
+            result.peakBullets = std::max(result.peakBullets, world.count<Projectile>());
+            result.peakParticles = std::max(result.peakParticles, world.count<Particle>());
+            result.peakExplosions = std::max(result.peakExplosions, world.count<Explosion>());
+        }
+        result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        
+        result.seed = seed;
+        result.ticks = simulation.getTick();
+        result.survivalSeconds = gameSeconds;
+        result.survived = !simulation.isGameOver();
+        result.score = simulation.getScore();
+        for (size_t type = 0; type < EnemyTypeCount; ++type) {
+            result.kills[type] = simulation.getKills(static_cast<EnemyType>(type));
+        }
+    }
+    
+    // Value at fraction of the way through sorted values
+    template<typename T>
+    T percentile(std::vector<T> values, double fraction) {
+        std::sort(values.begin(), values.end());
+        const size_t index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+        return values[index];
+    }
+    
+    bool writeCsv(const std::string& path, const std::vector<GameResult>& results) {
+        std::ofstream file(path, std::ios::trunc);
+        file << "seed,ticks,survival_s,survived,score,basic_kills,fast_kills,heavy_kills,wall_s,"
+                "peak_enemies,peak_bullets,peak_particles,peak_explosions\n";
+        for (const GameResult& result : results) {
+            file << result.seed << ',' << result.ticks << ',' << result.survivalSeconds << ','
+                 << (result.survived ? 1 : 0) << ',' << result.score;
+            for (const int kills : result.kills) {
+                file << ',' << kills;
+            }
+            file << ',' << result.wallSeconds << ',' << result.peakEnemies << ',' << result.peakBullets << ','
+                 << result.peakParticles << ',' << result.peakExplosions << '\n';
+        }
+        
+        if (!file.flush()) {
+            std::cerr << "Failed to write batch results: " << path << std::endl;
+            return false;
+        }
+        std::cout << "Per-game results written to " << path << std::endl;
+        return true;
+    }
+    
+    void printPeak(const char* name, const std::vector<GameResult>& results, size_t GameResult::*peak,
+                   size_t cap) {
+        size_t highest = 0;
+        size_t gamesAtCap = 0;
+        for (const GameResult& result : results) {
+            highest = std::max(highest, result.*peak);
+            gamesAtCap += result.*peak >= cap ? 1 : 0;
+        }
+        std::printf("  %-11s %6zu of %-6zu  %zu games reached the cap\n", name, highest, cap, gamesAtCap);
+    }
+}
+
+int BatchRunner::run(const Options& options) {
+    if (options.games == 0) {
+        std::cerr << "Batch needs at least one game" << std::endl;
+        return 2;
+    }
+    
+    // Bot games use the selected profile; replay-driven games keep the recording's settings and textures
+    Replay replay;
+    const bool useReplay = !options.replayPath.empty();
+    if (useReplay && (!replay.load(options.replayPath) || replay.frames.empty())) {
+        std::cerr << "Replay " << options.replayPath << " can't drive a batch" << std::endl;
+        return 2;
+    }
+    RuntimeSettings settings = replay.settings;
+    uint32_t assetMask = replay.assetMask;
+    if (!useReplay) {
+        // Found the way Game finds it, and never swapped for the defaults: the numbers would describe the wrong game
+        const std::string configPath = ResourceManager().resolvePath(Config::RuntimeConfigPath);
+        RuntimeConfig config;
+        if (!config.load(configPath, options.profile)) {
+            std::cerr << "Runtime config " << configPath << " can't drive a batch" << std::endl;
+            return 2;
+        }
+        settings = config.getSettings();
+        assetMask = options.assetMask;
+    }
+    const SimulationAssets assets = SimulationAssets::placeholders(assetMask);
+    
+    const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    const unsigned int threadCount = static_cast<unsigned int>(
+        std::min<size_t>(options.threads > 0 ? options.threads : hardwareThreads, options.games));
+    if (useReplay) {
+        // The inputs only make sense from the recorded seed, so every game repeats the same run
+        std::printf("Batch: %zu runs of %s (seed %u) on %u threads\n", options.games, options.replayPath.c_str(),
+                    replay.seed, threadCount);
+    } else {
+        std::printf("Batch: %zu games from seed %u on %u threads, bot player\n", options.games, options.firstSeed,
+                    threadCount);
+    }
+    
+    // Workers take the next game index until none are left; each keeps one Simulation
+    std::vector<GameResult> results(options.games);
+    std::atomic<size_t> nextGame{0};
+    std::atomic<size_t> finished{0};
+    const auto worker = [&]() {
+        Simulation simulation;
+        simulation.setAssets(assets);
+        simulation.applySettings(settings);
+        for (size_t game = nextGame++; game < options.games; game = nextGame++) {
+            const uint32_t seed = useReplay ? replay.seed : options.firstSeed + static_cast<uint32_t>(game);
+            play(simulation, options, settings, useReplay ? &replay : nullptr, seed, results[game]);
+            ++finished;
+        }
+    };
+    
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    
+    // Progress roughly every ten percent, from the main thread
+    size_t reported = 0;
+    while (finished.load() < options.games) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const size_t done = finished.load();
+        if (done * 10 / options.games > reported * 10 / options.games) {
+            std::printf("  %zu/%zu games\n", done, options.games);
+            std::fflush(stdout);
+            reported = done;
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    // Aggregate
+    std::vector<float> survival;
+    std::vector<int> scores;
+    std::array<long long, EnemyTypeCount> kills{};
+    uint64_t totalTicks = 0;
+    double gameSeconds = 0.0;
+    size_t survivors = 0;
+    for (const GameResult& result : results) {
+        survival.push_back(result.survivalSeconds);
+        scores.push_back(result.score);
+        for (size_t type = 0; type < EnemyTypeCount; ++type) {
+            kills[type] += result.kills[type];
+        }
+        totalTicks += result.ticks;
+        gameSeconds += result.wallSeconds;
+        survivors += result.survived ? 1 : 0;
+    }
+    const double games = static_cast<double>(options.games);
+    
+    std::printf("\n%zu games, %llu ticks in %.2f s\n", options.games, static_cast<unsigned long long>(totalTicks),
+                wallSeconds);
+    std::printf("Throughput: %.0f ticks/s overall, %.0f ticks/s per thread\n",
+                static_cast<double>(totalTicks) / wallSeconds, static_cast<double>(totalTicks) / gameSeconds);
+    
+    std::printf("\nSurvival (s):  min %.1f  median %.1f  p90 %.1f  max %.1f  (%zu survived)\n",
+                percentile(survival, 0.0), percentile(survival, 0.5), percentile(survival, 0.9),
+                percentile(survival, 1.0), survivors);
+    double scoreSum = 0.0;
+    for (const int score : scores) {
+        scoreSum += score;
+    }
+    std::printf("Score:         min %d  median %d  mean %.0f  max %d\n", percentile(scores, 0.0),
+                percentile(scores, 0.5), scoreSum / games, percentile(scores, 1.0));
+    std::printf("Kills per game:");
+    for (size_t type = 0; type < EnemyTypeCount; ++type) {
+        std::printf("  %s %.1f", enemyName(type), static_cast<double>(kills[type]) / games);
+    }
+    std::printf("\n");
+    
+    std::printf("\nPeak entities (most alive at once, against the profile's cap):\n");
+    printPeak("Enemies", results, &GameResult::peakEnemies, settings.maxEnemies);
+    printPeak("Bullets", results, &GameResult::peakBullets, settings.maxBullets);
+    printPeak("Particles", results, &GameResult::peakParticles, settings.maxParticles);
+    size_t explosions = 0;
+    for (const GameResult& result : results) {
+        explosions = std::max(explosions, result.peakExplosions);
+    }
+    std::printf("  %-11s %6zu\n", "Explosions", explosions);
+    
+    if (!options.csvPath.empty() && !writeCsv(options.csvPath, results)) return 2;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "BotPlayer.hpp"
+#include "Simulation.hpp"
+#include "Utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    // Push away from walls closer than BotWallMargin, stronger the closer they are
+    sf::Vector2f wallAvoidance(const sf::Vector2f& position) noexcept {
+        const auto push = [](float distance) {
+            return std::max(0.0f, 1.0f - distance / Config::BotWallMargin);
+        };
+        return sf::Vector2f(push(position.x) - push(Config::WindowWidth - position.x),
+                            push(position.y) - push(Config::WindowHeight - position.y));
+    }
+}
+
+BotPlayer::BotPlayer(float aggressiveness) noexcept
+    : m_aggressiveness(Utils::clamp(aggressiveness, 0.0f, 1.0f)),
+      m_standoff(Utils::lerp(Config::BotMaxStandoff, Config::BotMinStandoff, m_aggressiveness)),
+      m_dodgeWeight(Utils::lerp(2.0f, 0.75f, m_aggressiveness)) {
+}
+
+PlayerInput BotPlayer::decide(const Simulation& simulation, size_t slot) const {
+    PlayerInput input;
+    if (slot >= simulation.getPlayerCount() || !simulation.isPlayerAlive(slot)) return input;
+    
+    const World& world = simulation.getWorld();
+    const sf::Vector2f position = world.get<Transform>(simulation.getPlayer(slot))->position;
+    input.fire = true;
+    
+    // Nearest enemy is the target
+    float nearest = std::numeric_limits<float>::max();
+    sf::Vector2f toTarget;
+    world.each<Transform, EnemyAI>([&](const Transform& transform, const EnemyAI&) {
+        const sf::Vector2f offset = transform.position - position;
+        const float distance = offset.lengthSquared();
+        if (distance < nearest) {
+            nearest = distance;
+            toTarget = offset;
+        }
+    });
+    
+    // Close to the standoff range, then hold there and keep facing the target
+    sf::Vector2f move;
+    if (nearest < std::numeric_limits<float>::max()) {
+        const float distance = std::sqrt(nearest);
+        const sf::Vector2f heading = Utils::normalize(toTarget);
+        if (distance > m_standoff) {
+            move = heading;
+        } else if (distance < m_standoff * 0.5f) {
+            move = -heading;
+        } else {
+            move = heading * Config::BotAimNudge;
+        }
+    }
+    
+    // Sidestep enemy bullets whose path comes within BotDangerRadius in the next
+    // BotLookahead seconds; nearer and sooner misses count for more
+    sf::Vector2f dodge;
+    world.each<Transform, Velocity, Projectile>([&](const Transform& transform, const Velocity& velocity,
+                                                   const Projectile& projectile) {
+        if (projectile.fromPlayer) return;
+        
+        const float speedSquared = velocity.value.lengthSquared();
+        if (speedSquared <= 0.0f) return;
+        const sf::Vector2f offset = position - transform.position;
+        const float time = offset.dot(velocity.value) / speedSquared;
+        if (time < 0.0f || time > Config::BotLookahead) return;
+        
+        sf::Vector2f miss = offset - velocity.value * time;
+        const float missDistance = miss.length();
+        if (missDistance >= Config::BotDangerRadius) return;
+        
+        // Dead on: step to whichever side of the path is nearer the centre of the screen
+        if (missDistance < 1.0f) {
+            miss = sf::Vector2f(-velocity.value.y, velocity.value.x);
+            const sf::Vector2f centre(Config::WindowWidth / 2.0f, Config::WindowHeight / 2.0f);
+            if (miss.dot(centre - position) < 0.0f) {
+                miss = -miss;
+            }
+        }
+        const float urgency = (1.0f - missDistance / Config::BotDangerRadius) * (1.0f - time / Config::BotLookahead);
+        dodge += Utils::normalize(miss) * urgency;
+    });
+    
+    input.move = move + dodge * m_dodgeWeight + wallAvoidance(position);
+    if (input.move.lengthSquared() > 1.0f) {
+        input.move = Utils::normalize(input.move);
+    }
+    return input;
+}
\ No newline at end of file
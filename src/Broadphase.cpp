@@ -0,0 +1,264 @@
+#include "Broadphase.hpp"
+#include "UtilsSimd.hpp"
+#include "MemoryReport.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define SPACEDEFENDER_BROADPHASE_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define SPACEDEFENDER_BROADPHASE_NEON 1
+#endif
+
+namespace {
+    constexpr size_t Lanes = 4;
+
+    struct Query {
+        float left, right, top, bottom;
+        uint32_t layer, mask;
+    };
+
+    /**
+     * @brief Overlap bits for candidates [j, j + 4)
+     *
+     * Bit k is set when candidate j + k overlaps the query box and the layers
+     * interact. Sets *pastEnd once a candidate starts right of the query, since
+     * the sweep order guarantees every later candidate does too.
+     */
+    uint32_t overlapMask4(const float* left, const float* top, const float* bottom, const float* right,
+                          const uint32_t* layer, const uint32_t* mask, size_t j, const Query& q,
+                          bool* pastEnd) noexcept {
+#if defined(SPACEDEFENDER_BROADPHASE_SSE2)
+        const __m128 l = _mm_loadu_ps(left + j);
+        const __m128 inX = _mm_and_ps(_mm_cmplt_ps(l, _mm_set1_ps(q.right)),
+                                      _mm_cmpgt_ps(_mm_loadu_ps(right + j), _mm_set1_ps(q.left)));
+        const __m128 inY = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(top + j), _mm_set1_ps(q.bottom)),
+                                      _mm_cmpgt_ps(_mm_loadu_ps(bottom + j), _mm_set1_ps(q.top)));
+
+        const __m128i candidateLayer = _mm_loadu_si128(reinterpret_cast<const __m128i*>(layer + j));
+        const __m128i candidateMask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + j));
+        const __m128i interacts = _mm_or_si128(
+            _mm_and_si128(candidateLayer, _mm_set1_epi32(static_cast<int>(q.mask))),
+            _mm_and_si128(candidateMask, _mm_set1_epi32(static_cast<int>(q.layer))));
+        const __m128i ignored = _mm_cmpeq_epi32(interacts, _mm_setzero_si128());
+
+        const __m128 hit = _mm_andnot_ps(_mm_castsi128_ps(ignored), _mm_and_ps(inX, inY));
+        *pastEnd = (_mm_movemask_ps(_mm_cmplt_ps(l, _mm_set1_ps(q.right))) & 0x8) == 0;
+        return static_cast<uint32_t>(_mm_movemask_ps(hit));
+#elif defined(SPACEDEFENDER_BROADPHASE_NEON)
+        const float32x4_t l = vld1q_f32(left + j);
+        const uint32x4_t startsBefore = vcltq_f32(l, vdupq_n_f32(q.right));
+        const uint32x4_t inX = vandq_u32(startsBefore, vcgtq_f32(vld1q_f32(right + j), vdupq_n_f32(q.left)));
+        const uint32x4_t inY = vandq_u32(vcltq_f32(vld1q_f32(top + j), vdupq_n_f32(q.bottom)),
+                                         vcgtq_f32(vld1q_f32(bottom + j), vdupq_n_f32(q.top)));
+
+        const uint32x4_t interacts = vorrq_u32(vandq_u32(vld1q_u32(layer + j), vdupq_n_u32(q.mask)),
+                                               vandq_u32(vld1q_u32(mask + j), vdupq_n_u32(q.layer)));
+        const uint32x4_t hit = vandq_u32(vandq_u32(inX, inY), vtstq_u32(interacts, interacts));
+
+        // Narrow each lane to one bit
+        static const uint32x4_t laneBits = {1, 2, 4, 8};
+        *pastEnd = vgetq_lane_u32(startsBefore, 3) == 0;
+        return vaddvq_u32(vandq_u32(hit, laneBits));
+#else
+        uint32_t bits = 0;
+        for (size_t k = 0; k < Lanes; ++k) {
+            const size_t c = j + k;
+            const bool overlaps = left[c] < q.right && right[c] > q.left && top[c] < q.bottom && bottom[c] > q.top;
+            const bool interacts = ((layer[c] & q.mask) | (mask[c] & q.layer)) != 0;
+            bits |= static_cast<uint32_t>(overlaps && interacts) << k;
+        }
+        *pastEnd = !(left[j + Lanes - 1] < q.right);
+        return bits;
+#endif
+    }
+}
+
+void Broadphase::clear() noexcept {
+    m_submitted.clear();
+    m_submittedBoxes.clear();
+    m_pairs.clear();
+
+    // Stamps let add() skip clearing the slot table every frame
+    if (++m_stamp == 0) {
+        std::fill(m_slotStamp.begin(), m_slotStamp.end(), 0);
+        m_stamp = 1;
+    }
+}
+
+void Broadphase::reserve(size_t proxies, size_t entityIndices) {
+    m_submitted.reserve(proxies);
+    m_submittedBoxes.reserve(proxies);
+    m_sorted.reserve(proxies);
+    m_pairs.reserve(proxies);
+    m_candidates.reserve(proxies);
+    m_left.reserve(proxies + Lanes);
+    m_right.reserve(proxies + Lanes);
+    m_top.reserve(proxies + Lanes);
+    m_bottom.reserve(proxies + Lanes);
+    m_layer.reserve(proxies + Lanes);
+    m_mask.reserve(proxies + Lanes);
+    if (entityIndices > m_submittedSlot.size()) {
+        m_submittedSlot.resize(entityIndices, 0);
+        m_slotStamp.resize(entityIndices, 0);
+    }
+}
+
+size_t Broadphase::memoryBytes() const noexcept {
+    return MemoryReport::capacityBytes(m_submitted, m_submittedBoxes, m_sorted, m_submittedSlot, m_slotStamp, m_left,
+                                       m_right, m_top, m_bottom, m_layer, m_mask, m_candidates, m_pairs);
+}
+
+void Broadphase::add(Entity entity, const sf::FloatRect& box, uint32_t layer, uint32_t mask) {
+    const uint32_t index = entity.index();
+    if (index >= m_submittedSlot.size()) {
+        m_submittedSlot.resize(index + 1, 0);
+        m_slotStamp.resize(index + 1, 0);
+    }
+    m_submittedSlot[index] = static_cast<uint32_t>(m_submitted.size()) + 1;
+    m_slotStamp[index] = m_stamp;
+
+    m_submitted.push_back({box.position.x, box.position.x + box.size.x,
+                           box.position.y, box.position.y + box.size.y,
+                           layer, mask, entity});
+    m_submittedBoxes.push_back(box);
+}
+
+const std::vector<CollisionPair>& Broadphase::findPairs() {
+    m_pairs.clear();
+    m_stats.proxies = m_submitted.size();
+    m_stats.overlapTests = 0;
+    m_stats.sortMoves = 0;
+
+    if (m_mode == BroadphaseMode::BruteForce) {
+        findPairsBruteForce();
+    } else {
+        findPairsSortAndSweep();
+    }
+
+    m_stats.pairs = m_pairs.size();
+    return m_pairs;
+}
+
+void Broadphase::findPairsBruteForce() {
+    // Leave the sweep order empty so switching modes rebuilds it from scratch
+    m_sorted.clear();
+    pack(m_submitted);
+
+    const size_t count = m_submitted.size();
+    m_candidates.resize(count);
+    for (size_t i = 0; i + 1 < count; ++i) {
+        const Proxy& a = m_submitted[i];
+        const size_t first = i + 1;
+        const size_t found = Utils::Simd::overlapping(m_left.data() + first, m_top.data() + first,
+                                                      m_right.data() + first, m_bottom.data() + first,
+                                                      count - first, m_submittedBoxes[i], m_candidates.data());
+        m_stats.overlapTests += count - first;
+
+        for (size_t k = 0; k < found; ++k) {
+            const Proxy& b = m_submitted[first + m_candidates[k]];
+            if (((a.layer & b.mask) | (b.layer & a.mask)) == 0) continue;
+            m_pairs.push_back({a.entity, b.entity});
+        }
+    }
+}
+
+void Broadphase::findPairsSortAndSweep() {
+    mergeIntoSorted();
+    insertionSort();
+    pack(m_sorted);
+
+    const size_t count = m_sorted.size();
+    for (size_t i = 0; i < count; ++i) {
+        const Query query{m_left[i], m_right[i], m_top[i], m_bottom[i], m_layer[i], m_mask[i]};
+
+        // Candidates start right of i; stop at the first block that begins past i's right edge
+        for (size_t j = i + 1; j < count; j += Lanes) {
+            bool pastEnd = false;
+            uint32_t bits = overlapMask4(m_left.data(), m_top.data(), m_bottom.data(), m_right.data(),
+                                         m_layer.data(), m_mask.data(), j, query, &pastEnd);
+            m_stats.overlapTests += Lanes;
+
+            // Padding lanes never overlap, so only real candidates can set bits
+            while (bits != 0) {
+                const auto lane = static_cast<size_t>(std::countr_zero(bits));
+                m_pairs.push_back({m_sorted[i].entity, m_sorted[j + lane].entity});
+                bits &= bits - 1;
+            }
+            if (pastEnd) break;
+        }
+    }
+}
+
+void Broadphase::mergeIntoSorted() {
+    // Keep last frame's order for proxies that came back; their boxes are replaced
+    size_t kept = 0;
+    for (const Proxy& previous : m_sorted) {
+        const uint32_t index = previous.entity.index();
+        if (index >= m_slotStamp.size() || m_slotStamp[index] != m_stamp) continue;
+
+        uint32_t& slot = m_submittedSlot[index];
+        if (slot == 0 || m_submitted[slot - 1].entity != previous.entity) continue;
+
+        m_sorted[kept++] = m_submitted[slot - 1];
+        slot = 0;   // Consumed
+    }
+    m_sorted.resize(kept);
+
+    // Newcomers go on the end and are sorted into place below
+    for (const Proxy& proxy : m_submitted) {
+        if (m_submittedSlot[proxy.entity.index()] != 0) {
+            m_sorted.push_back(proxy);
+        }
+    }
+}
+
+void Broadphase::insertionSort() noexcept {
+    for (size_t i = 1; i < m_sorted.size(); ++i) {
+        if (!(m_sorted[i].left < m_sorted[i - 1].left)) continue;
+
+        const Proxy moving = m_sorted[i];
+        size_t j = i;
+        while (j > 0 && moving.left < m_sorted[j - 1].left) {
+            m_sorted[j] = m_sorted[j - 1];
+            --j;
+        }
+        m_sorted[j] = moving;
+        m_stats.sortMoves += i - j;
+    }
+}
+
+void Broadphase::pack(const std::vector<Proxy>& proxies) {
+    const size_t count = proxies.size();
+    const size_t padded = count + Lanes;
+    m_left.resize(padded);
+    m_right.resize(padded);
+    m_top.resize(padded);
+    m_bottom.resize(padded);
+    m_layer.resize(padded);
+    m_mask.resize(padded);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Proxy& proxy = proxies[i];
+        m_left[i] = proxy.left;
+        m_right[i] = proxy.right;
+        m_top[i] = proxy.top;
+        m_bottom[i] = proxy.bottom;
+        m_layer[i] = proxy.layer;
+        m_mask[i] = proxy.mask;
+    }
+
+    // Sentinels start at +infinity and interact with nothing
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    for (size_t i = count; i < padded; ++i) {
+        m_left[i] = infinity;
+        m_right[i] = infinity;
+        m_top[i] = infinity;
+        m_bottom[i] = infinity;
+        m_layer[i] = 0;
+        m_mask[i] = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "BulletSystem.hpp"
+#include "Config.hpp"
+#include "Utils.hpp"
+#include <cmath>
+
+namespace BulletSystem {
+    Entity spawn(World& world, const sf::Vector2f& position, const sf::Vector2f& direction, bool isPlayerBullet,
+                 const sf::Texture* texture) {
+        const float speed = isPlayerBullet ? Config::BulletSpeed : Config::EnemyBulletSpeed;
+        const float radius = isPlayerBullet ? Config::PlayerBulletRadius : Config::EnemyBulletRadius;
+        
+        // Rotation follows the direction of travel
+        const Transform transform{position, Utils::radToDeg(std::atan2(direction.y, direction.x))};
+        const Velocity velocity{Utils::normalize(direction) * speed};
+        const Projectile projectile{isPlayerBullet ? Config::PlayerDamage : Config::EnemyDamage, position, isPlayerBullet};
+        const sf::Color debugColor = isPlayerBullet ?
+            sf::Color(255, 255, 0, 192) :   // Bright yellow for player bullets
+            sf::Color(255, 0, 0, 192);      // Bright red for enemy bullets
+        
+        if (texture) {
+            const sf::Vector2f size(radius * 6.0f, radius * 6.0f);
+            return world.create(transform, velocity, projectile,
+                                Collider{size, Config::BulletBoundsTightnessRatio, true, debugColor}, Bounds{},
+                                SpriteVisual::fit(*texture, size, RenderLayer::Bullets));
+        }
+        
+        const ShapeVisual circle{ShapeVisual::Kind::Circle, radius, isPlayerBullet ? sf::Color::Yellow : sf::Color::Red,
+                                 sf::Color::Transparent, 0.0f, RenderLayer::Bullets};
+        return world.create(transform, velocity, projectile,
+                            Collider{sf::Vector2f(2.0f * radius, 2.0f * radius), Config::BulletBoundsTightnessRatio,
+                                     false, debugColor}, Bounds{},
+                            circle);
+    }
+    
+    void reserve(World& world, size_t count) {
+        world.reserve<Transform, Velocity, Projectile, Collider, Bounds, SpriteVisual>(count);
+        world.reserve<Transform, Velocity, Projectile, Collider, Bounds, ShapeVisual>(count);
+    }
+    
+    void cullOffscreen(World& world) noexcept {
+        constexpr float margin = 50.0f;
+        world.each<Transform, Projectile>([&world](Entity bullet, const Transform& transform, const Projectile&) {
+            const sf::Vector2f& position = transform.position;
+            if (position.x < -margin || position.x > Config::WindowWidth + margin ||
+                position.y < -margin || position.y > Config::WindowHeight + margin) {
+                world.destroyLater(bullet);
+            }
+        });
+    }
+}
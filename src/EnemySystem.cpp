@@ -0,0 +1,271 @@
+#include "EnemySystem.hpp"
+#include "Config.hpp"
+#include "Utils.hpp"
+#include "UtilsSimd.hpp"
+#include "MemoryReport.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    struct EnemyStats {
+        float maxHealth;
+        float speed;
+        float shootCooldown;
+        float radius;
+        sf::Color color;
+        sf::Color debugColor;
+    };
+    
+    EnemyStats statsFor(EnemyType type) noexcept {
+        switch (type) {
+            case EnemyType::FastEnemy:
+                return {30.0f, 200.0f, 1.5f, 10.0f, sf::Color::Green, sf::Color(0, 255, 255, 192)};
+            case EnemyType::HeavyEnemy:
+                return {100.0f, 50.0f, 3.0f, 20.0f, sf::Color(255, 128, 0), sf::Color(255, 128, 0, 192)};
+            case EnemyType::BasicEnemy:
+                break;
+        }
+        return {50.0f, 100.0f, 2.0f, 15.0f, sf::Color::Magenta, sf::Color(255, 0, 255, 192)};
+    }
+    
+    sf::Vector2f randomDirection(std::mt19937& rng) noexcept {
+        std::uniform_real_distribution<float> angleDist(0, Config::TwoPi);
+        const float angle = angleDist(rng);
+        return sf::Vector2f(std::cos(angle), std::sin(angle));
+    }
+    
+    // Seconds until the next heading change, 2-4 like the original wander rule
+    float nextTurnDelay(std::mt19937& rng) noexcept {
+        std::uniform_real_distribution<float> delayDist(2.0f, 4.0f);
+        return delayDist(rng);
+    }
+    
+    // cond ? a : b as arithmetic. GCC won't if-convert float selects under its
+    // default -ftrapping-math, and only vectorizes the bool conversion via int
+    inline float blend(bool cond, float a, float b) noexcept {
+        return b + static_cast<float>(static_cast<int>(cond)) * (a - b);
+    }
+    
+    // Fade towards half transparency as health drops
+    sf::Color damageTint(sf::Color color, const Health& health) noexcept {
+        if (health.current < health.max) {
+            color.a = static_cast<std::uint8_t>(128 + 127 * health.ratio());
+        }
+        return color;
+    }
+}
+
+namespace EnemySystem {
+    Entity spawn(World& world, const sf::Vector2f& position, EnemyType type, std::mt19937& rng,
+                 const sf::Texture* texture) {
+        const EnemyStats stats = statsFor(type);
+        
+        const Transform transform{position, 0.0f};
+        const Health health{stats.maxHealth, stats.maxHealth};
+        const Weapon weapon{stats.shootCooldown, stats.shootCooldown};
+        const EnemyAI ai{randomDirection(rng), stats.speed, 0.0f, nextTurnDelay(rng), stats.radius, stats.color, type};
+        const Velocity velocity{ai.direction * ai.speed};
+        
+        if (texture) {
+            // All enemies share the player's on-screen size
+            const sf::Vector2f size(Config::PlayerSpriteSize, Config::PlayerSpriteSize);
+            return world.create(transform, velocity, health, weapon, ai,
+                                Collider{size, Config::SpriteBoundsTightnessRatio, true, stats.debugColor}, Bounds{},
+                                SpriteVisual::fit(*texture, size, RenderLayer::Enemies, Config::SpriteOrientationOffset));
+        }
+        
+        const ShapeVisual circle{ShapeVisual::Kind::Circle, stats.radius, stats.color, sf::Color::White, 2.0f,
+                                 RenderLayer::Enemies};
+        const float diameter = 2.0f * (stats.radius + circle.outlineThickness);
+        return world.create(transform, velocity, health, weapon, ai,
+                            Collider{sf::Vector2f(diameter, diameter), Config::SpriteBoundsTightnessRatio, false,
+                                     stats.debugColor}, Bounds{},
+                            circle);
+    }
+    
+    void reserve(World& world, size_t count) {
+        world.reserve<Transform, Velocity, Health, Weapon, EnemyAI, Collider, Bounds, SpriteVisual>(count);
+        world.reserve<Transform, Velocity, Health, Weapon, EnemyAI, Collider, Bounds, ShapeVisual>(count);
+    }
+    
+    void Batch::resize(size_t rows) {
+        for (std::vector<float>* column : {&x, &y, &dirX, &dirY, &speed, &radius, &moveTimer, &turnAt,
+                                           &weaponTimer, &rotation, &aimX, &aimY, &aimAngle}) {
+            column->resize(rows);
+        }
+        firing.resize(rows);
+    }
+    
+    size_t Batch::memoryBytes() const noexcept {
+        return MemoryReport::capacityBytes(x, y, dirX, dirY, speed, radius, moveTimer, turnAt, weaponTimer, rotation,
+                                           aimX, aimY, aimAngle, firing);
+    }
+    
+    void update(World& world, Batch& batch, std::mt19937& rng, const sf::Vector2f* targets, size_t targetCount,
+                float deltaTime, std::vector<Entity>& shooters) {
+        world.eachBatch<Transform, Velocity, Weapon, EnemyAI>(
+            [&](size_t rows, const Entity* entities, Transform* transforms, Velocity* velocities, Weapon* weapons,
+                EnemyAI* ais) {
+                batch.resize(rows);
+                float* const x = batch.x.data();
+                float* const y = batch.y.data();
+                float* const dirX = batch.dirX.data();
+                float* const dirY = batch.dirY.data();
+                float* const speed = batch.speed.data();
+                float* const radius = batch.radius.data();
+                float* const moveTimer = batch.moveTimer.data();
+                float* const turnAt = batch.turnAt.data();
+                float* const weaponTimer = batch.weaponTimer.data();
+                float* const rotation = batch.rotation.data();
+                
+                for (size_t i = 0; i < rows; ++i) {
+                    x[i] = transforms[i].position.x;
+                    y[i] = transforms[i].position.y;
+                    rotation[i] = transforms[i].rotation;
+                    dirX[i] = ais[i].direction.x;
+                    dirY[i] = ais[i].direction.y;
+                    speed[i] = ais[i].speed;
+                    radius[i] = ais[i].radius;
+                    moveTimer[i] = ais[i].moveTimer;
+                    turnAt[i] = ais[i].turnAt;
+                    weaponTimer[i] = weapons[i].timer;
+                }
+                
+                // Timers
+                for (size_t i = 0; i < rows; ++i) {
+                    moveTimer[i] += deltaTime;
+                    weaponTimer[i] = std::max(0.0f, weaponTimer[i] - deltaTime);
+                }
+                
+                // New headings are rare, so draw them in a separate scalar loop
+                for (size_t i = 0; i < rows; ++i) {
+                    if (moveTimer[i] >= turnAt[i]) {
+                        const sf::Vector2f direction = randomDirection(rng);
+                        dirX[i] = direction.x;
+                        dirY[i] = direction.y;
+                        moveTimer[i] = 0.0f;
+                        turnAt[i] = nextTurnDelay(rng);
+                    }
+                }
+                
+                // Wall bounces: reflect the heading and clamp back inside
+                for (size_t i = 0; i < rows; ++i) {
+                    const float r = radius[i];
+                    const float maxX = Config::WindowWidth - r;
+                    const float maxY = Config::WindowHeight - r;
+                    // Bitwise | and & keep these loops free of branches
+                    const bool outX = (x[i] < r) | (x[i] > maxX);
+                    const bool outY = (y[i] < r) | (y[i] > maxY);
+                    dirX[i] = outX ? -dirX[i] : dirX[i];
+                    dirY[i] = outY ? -dirY[i] : dirY[i];
+                    x[i] = std::min(std::max(x[i], r), maxX);
+                    y[i] = std::min(std::max(y[i], r), maxY);
+                }
+                
+                size_t firingCount = 0;
+                if (targetCount > 0) {
+                    // Face the nearest player (shooting direction), not the movement direction
+                    float* const aimX = batch.aimX.data();
+                    float* const aimY = batch.aimY.data();
+                    float* const aimAngle = batch.aimAngle.data();
+                    for (size_t i = 0; i < rows; ++i) {
+                        aimX[i] = targets[0].x - x[i];
+                        aimY[i] = targets[0].y - y[i];
+                    }
+                    for (size_t t = 1; t < targetCount; ++t) {
+                        const float targetX = targets[t].x;
+                        const float targetY = targets[t].y;
+                        for (size_t i = 0; i < rows; ++i) {
+                            const float dx = targetX - x[i];
+                            const float dy = targetY - y[i];
+                            const bool closer = dx * dx + dy * dy < aimX[i] * aimX[i] + aimY[i] * aimY[i];
+                            aimX[i] = closer ? dx : aimX[i];
+                            aimY[i] = closer ? dy : aimY[i];
+                        }
+                    }
+                    Utils::Simd::atan2(aimY, aimX, aimAngle, rows);
+                    for (size_t i = 0; i < rows; ++i) {
+                        const bool onTarget = (aimX[i] == 0.0f) & (aimY[i] == 0.0f);
+                        rotation[i] = blend(onTarget, rotation[i], aimAngle[i] * (180.0f / Config::Pi));
+                    }
+                    
+                    // Compact ready rows without branching on each one
+                    uint32_t* const firing = batch.firing.data();
+                    for (size_t i = 0; i < rows; ++i) {
+                        firing[firingCount] = static_cast<uint32_t>(i);
+                        firingCount += weaponTimer[i] <= 0.0f;
+                    }
+                }
+                
+                for (size_t i = 0; i < rows; ++i) {
+                    transforms[i].position = sf::Vector2f(x[i], y[i]);
+                    transforms[i].rotation = rotation[i];
+                    velocities[i].value = sf::Vector2f(dirX[i] * speed[i], dirY[i] * speed[i]);
+                    ais[i].direction = sf::Vector2f(dirX[i], dirY[i]);
+                    ais[i].moveTimer = moveTimer[i];
+                    ais[i].turnAt = turnAt[i];
+                    weapons[i].timer = weaponTimer[i];
+                }
+                
+                for (size_t k = 0; k < firingCount; ++k) {
+                    const Entity enemy = entities[batch.firing[k]];
+                    if (world.isAlive(enemy)) {
+                        shooters.push_back(enemy);
+                    }
+                }
+            });
+        
+        // Tint is render state, so write it here rather than while drawing
+        world.each<EnemyAI, Health, SpriteVisual>([](const EnemyAI&, const Health& health, SpriteVisual& visual) {
+            visual.color = damageTint(sf::Color::White, health);
+        });
+        world.each<EnemyAI, Health, ShapeVisual>([](const EnemyAI& ai, const Health& health, ShapeVisual& visual) {
+            visual.fill = damageTint(ai.baseColor, health);
+        });
+    }
+    
+    const sf::Vector2f& nearestTarget(const sf::Vector2f& position, const sf::Vector2f* targets,
+                                      size_t targetCount) noexcept {
+        // Same comparison as update(), so enemies shoot where they face
+        size_t nearest = 0;
+        sf::Vector2f offset = targets[0] - position;
+        for (size_t t = 1; t < targetCount; ++t) {
+            const sf::Vector2f candidate = targets[t] - position;
+            if (candidate.x * candidate.x + candidate.y * candidate.y < offset.x * offset.x + offset.y * offset.y) {
+                nearest = t;
+                offset = candidate;
+            }
+        }
+        return targets[nearest];
+    }
+    
+    sf::Vector2f getShootDirection(const Transform& transform, const sf::Vector2f& target) noexcept {
+        return Utils::normalize(target - transform.position);
+    }
+    
+    sf::Vector2f getCenteredShootPosition(World& world, Entity enemy, const sf::Vector2f& target) noexcept {
+        const Transform* transform = world.get<Transform>(enemy);
+        const Collider* collider = world.get<Collider>(enemy);
+        Bounds* bounds = world.get<Bounds>(enemy);
+        if (!transform || !collider || !bounds) return {};
+        
+        // update() may have bounced or turned the enemy since the last bounds pass
+        bounds->refresh(*transform, *collider);
+        
+        // Sprites measure from the full visual box, shapes from the hit box
+        const sf::FloatRect& box = world.has<SpriteVisual>(enemy) ? bounds->visual : bounds->collision;
+        const float spriteRadius = std::max(box.size.x, box.size.y) * 0.5f;
+        
+        // Position projectile just outside the sprite edge in shooting direction
+        return transform->position + getShootDirection(*transform, target) * (spriteRadius + 5.0f); // +5px buffer
+    }
+    
+    int getScoreValue(EnemyType type) noexcept {
+        switch (type) {
+            case EnemyType::BasicEnemy: return 10;
+            case EnemyType::FastEnemy: return 20;
+            case EnemyType::HeavyEnemy: return 30;
+        }
+        return 10;
+    }
+}
@@ -0,0 +1,72 @@
+#include "ExplosionSystem.hpp"
+
+namespace {
+    struct ExplosionStyle {
+        float scale;
+        float frameTime;
+    };
+    
+    ExplosionStyle styleFor(ExplosionType type) noexcept {
+        switch (type) {
+            case ExplosionType::Small:
+                return {0.6f, 0.06f};  // Fast, snappy animation for bullet hits
+            case ExplosionType::Large:
+                return {1.5f, 0.1f};   // Slower, more dramatic for player/heavy enemies
+            case ExplosionType::Medium:
+                break;
+        }
+        return {1.0f, 0.08f};          // Medium speed for basic enemies
+    }
+    
+    sf::IntRect frameRect(const Explosion& explosion) noexcept {
+        const int row = explosion.frame / explosion.framesPerRow;
+        const int col = explosion.frame % explosion.framesPerRow;
+        return sf::IntRect(sf::Vector2i(col * explosion.frameSize.x, row * explosion.frameSize.y),
+                           explosion.frameSize);
+    }
+}
+
+void ExplosionSystem::initialize(const sf::Texture* texture) {
+    m_explosionTexture = texture;
+}
+
+void ExplosionSystem::createExplosion(World& world, const sf::Vector2f& position, ExplosionType type) {
+    if (!m_explosionTexture) return;
+    
+    const ExplosionStyle style = styleFor(type);
+    const sf::Vector2u sheetSize = m_explosionTexture->getSize();
+    
+    Explosion explosion;
+    explosion.frameTime = style.frameTime;
+    explosion.totalFrames = TotalFrames;
+    explosion.framesPerRow = FramesPerRow;
+    explosion.frameSize = sf::Vector2i(static_cast<int>(sheetSize.x) / FramesPerRow,
+                                       static_cast<int>(sheetSize.y) / (TotalFrames / FramesPerRow));
+    
+    SpriteVisual visual;
+    visual.texture = m_explosionTexture;
+    visual.textureRect = frameRect(explosion);
+    visual.size = sf::Vector2f(explosion.frameSize) * style.scale;
+    visual.layer = RenderLayer::Explosions;
+    
+    world.create(Transform{position, 0.0f}, explosion, visual);
+}
+
+void ExplosionSystem::reserve(World& world, size_t count) {
+    world.reserve<Transform, Explosion, SpriteVisual>(count);
+}
+
+void ExplosionSystem::update(World& world, float deltaTime) noexcept {
+    world.each<Explosion, SpriteVisual>([&world, deltaTime](Entity entity, Explosion& explosion, SpriteVisual& visual) {
+        explosion.frameTimer += deltaTime;
+        if (explosion.frameTimer < explosion.frameTime) return;
+        
+        explosion.frameTimer -= explosion.frameTime;
+        if (++explosion.frame >= explosion.totalFrames) {
+            // Animation finished
+            world.destroyLater(entity);
+            return;
+        }
+        visual.textureRect = frameRect(explosion);
+    });
+}
@@ -0,0 +1,48 @@
+#include "FrameArena.hpp"
+#include <algorithm>
+
+FrameArena::FrameArena(size_t capacity) {
+    m_block.data = std::make_unique<std::byte[]>(capacity);
+    m_block.size = capacity;
+    m_top = m_block.data.get();
+    m_end = m_top + capacity;
+    m_stats.capacity = capacity;
+}
+
+void FrameArena::reset() {
+    m_framePeak = std::max(m_framePeak, m_used);
+    m_stats.peak = std::max(m_stats.peak, m_framePeak);
+    
+    // Outgrown: one block sized for this frame from now on
+    if (!m_overflow.empty()) {
+        m_overflow.clear();
+        const size_t capacity = std::max(m_block.size * 2, m_framePeak + m_framePeak / 4);
+        m_block.data = std::make_unique<std::byte[]>(capacity);
+        m_block.size = capacity;
+        m_stats.capacity = capacity;
+        m_stats.growths++;
+    }
+    
+    m_top = m_block.data.get();
+    m_end = m_top + m_block.size;
+    m_used = 0;
+    m_framePeak = 0;
+}
+
+FrameArena::Statistics FrameArena::getStats() const noexcept {
+    Statistics stats = m_stats;
+    stats.used = m_used;
+    stats.peak = std::max({stats.peak, m_framePeak, m_used});
+    return stats;
+}
+
+void* FrameArena::allocateSlow(size_t size, size_t alignment) {
+    // Room for the worst-case alignment padding too
+    Block block;
+    block.size = std::max(m_block.size, size + alignment);
+    block.data = std::make_unique<std::byte[]>(block.size);
+    m_top = block.data.get();
+    m_end = m_top + block.size;
+    m_overflow.push_back(std::move(block));
+    return allocate(size, alignment);
+}
\ No newline at end of file
@@ -1,13 +1,15 @@
 #include "Game.hpp"
 #include "Config.hpp"
 #include "Utils.hpp"
+#include "UtilsSimd.hpp"
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
 
-Game::Game() : m_window(sf::VideoMode({Config::WindowWidth, Config::WindowHeight}),
-                       "Space Defender - Enhanced Edition") {
+Game::Game(const GameOptions& options) : m_window(sf::VideoMode({Config::WindowWidth, Config::WindowHeight}),
+                       "Space Defender - Enhanced Edition"), m_options(options) {
     m_window.setFramerateLimit(Config::TargetFPS);
     m_window.requestFocus();
     
@@ -52,22 +54,51 @@ Game::Game() : m_window(sf::VideoMode({Config::WindowWidth, Config::WindowHeight
         std::cout << "Main menu background sprite enabled" << std::endl;
     }
     
-    // Initialize object pools
-    m_playerPool.initialize(1);
-    m_enemyPool.initialize(Config::EnemyPoolSize);
-    m_bulletPool.initialize(Config::BulletPoolSize);
+    // Co-op falls back to single player if the socket can't be set up
+    if (m_options.coop && !openNetplay()) {
+        m_options.coop.reset();
+    }
     
-    // Reserve vectors
-    m_activeEnemies.reserve(Config::MaxEnemies);
-    m_activeBullets.reserve(Config::MaxBullets);
+    if (m_options.bot) {
+        m_bot.emplace(*m_options.bot);
+        std::cout << "Bot playing (aggressiveness " << m_bot->getAggressiveness() << ")" << std::endl;
+    }
     
-    // Initialize UI if font loaded
-    if (m_resources.isFontLoaded()) {
-        initializeUI();
+    if (m_options.allocationCheck) {
+        if (AllocationTracker::isAvailable()) {
+            // Keep every stack, so the first offending allocation can be shown
+            AllocationTracker::setSampleInterval(1);
+            std::cout << "Allocation check: ticks and frames after the first " << Config::AllocationWarmupTicks
+                      << " of a game must not allocate" << std::endl;
+        } else {
+            std::cerr << "Warning: --alloc-check needs a build with SPACEDEFENDER_TRACK_ALLOCATIONS" << std::endl;
+        }
+    }
+    
+    // Load runtime tuning profile (Config.hpp values are the fallback)
+    m_runtimeConfig.load(m_resources.resolvePath(Config::RuntimeConfigPath), m_options.profile);
+    
+    // Reserve entity storage, size particle budget and set the frame limiter
+    applyRuntimeSettings();
+    
+    // Cache for the frozen menu, pause and game over screens
+    if (m_idleFrame.resize({Config::WindowWidth, Config::WindowHeight})) {
+        m_idleFrameReady = true;
+    } else {
+        std::cerr << "Warning: Failed to create idle frame texture, menus will redraw directly" << std::endl;
     }
     
-    // Initialize explosion manager
-    m_explosionManager.initialize(m_resources);
+    // Lay out the HUD; it stays hidden if the font didn't load
+    initializeUI();
+    
+    // New entities use whichever textures loaded; the rest fall back to shapes
+    const SimulationAssets assets = SimulationAssets::fromResources(m_resources);
+    m_simulation.setAssets(assets);
+    if (assets.explosion) {
+        std::cout << "Explosion texture loaded successfully" << std::endl;
+    } else {
+        std::cout << "Warning: No explosion texture found. Explosions will be disabled." << std::endl;
+    }
     
     // Initialize grid
     initializeGrid();
@@ -79,49 +110,221 @@ Game::Game() : m_window(sf::VideoMode({Config::WindowWidth, Config::WindowHeight
     std::cout << "Use WASD or arrow keys to move, SPACE or mouse to shoot." << std::endl;
 }
 
+Game::~Game() {
+    stopSimulation();
+    finishRecording();
+}
+
 void Game::run() {
     try {
+        if (m_bot && !m_options.coop) {
+            startNewGame();
+        }
         while (m_window.isOpen()) {
-            float deltaTime = m_clock.restart().asSeconds();
+            updateMemoryReport();
+            if (isIdleState()) {
+                runIdleFrame();
+                m_frameArena.reset();
+                continue;
+            }
+            m_idleFrameValid = false;
             
-            // Clamp delta time to prevent spiral of death
-            deltaTime = std::min(deltaTime, Config::MaxDeltaTime);
+            const float deltaTime = m_clock.restart().asSeconds();
+            
+            // Settings changes stop and restart the simulation thread around them
+            reloadRuntimeConfig(deltaTime);
             
             m_performanceMonitor.update(deltaTime);
             m_inputManager.update();
             
             handleEvents();
-            update(deltaTime);
+            shareInput();
+            
+            // Draw the newest tick the simulation thread finished; it keeps running meanwhile
+            if (m_snapshots.update()) {
+                playSounds(m_snapshots.front().sounds);
+            }
+            if (m_currentState == GameState::Playing && m_snapshots.front().gameOver) {
+                stopSimulation();
+                finishRecording();
+                endNetplay();
+                m_currentState = GameState::GameOver;
+                reportAllocations();
+                if (m_bot && !m_options.coop) {
+                    std::cout << "Bot game " << ++m_botGames << ": score " << m_simulation.getScore() << ", "
+                              << m_simulation.getEnemiesKilled() << " kills in " << m_simulation.getTick()
+                              << " ticks" << std::endl;
+                    startNewGame();
+                }
+            }
+            const AllocationTracker::Scope frameScope;
             render();
+            m_frameAllocations = frameScope.counts();
+            m_frameArena.reset();
+            
+            // Frames drawn after game over format new text, so only count play
+            if (m_currentState == GameState::Playing && ++m_gameFrames > Config::AllocationWarmupTicks &&
+                m_frameAllocations.allocations > 0) {
+                m_warmFrameAllocations.allocations += m_frameAllocations.allocations;
+                m_warmFrameAllocations.bytes += m_frameAllocations.bytes;
+                if (m_options.allocationCheck) {
+                    std::cerr << "Allocation check failed: frame " << m_gameFrames << " made "
+                              << m_frameAllocations.allocations << " allocations (" << m_frameAllocations.bytes
+                              << " bytes)" << std::endl;
+                    AllocationTracker::printSamples(std::this_thread::get_id(), m_frameAllocations.allocations);
+                    m_allocationCheckFailed = true;
+                }
+            }
+            if (m_allocationCheckFailed) {
+                cleanup();
+                m_window.close();
+            }
         }
     }
     catch (const std::exception& e) {
         std::cerr << "Game error: " << e.what() << std::endl;
     }
+    
+    if (!m_options.memoryReportPath.empty()) {
+        saveMemoryReport();
+    }
 }
 
-void Game::initializeUI() {
-    const auto& font = m_resources.getFont();
+void Game::runIdleFrame() {
+    // Nothing moves on these screens, so only redraw for new screens and events
+    if (m_idleFrameState != m_currentState) {
+        m_idleFrameState = m_currentState;
+        m_idleFrameValid = false;
+    }
+    if (!m_idleFrameValid || m_idlePresentPending) {
+        presentIdleFrame();
+        m_idlePresentPending = false;
+    }
+    
+    // Sleep until input or a window event; time out so profile edits are still picked up
+    if (const std::optional<sf::Event> event = m_window.waitEvent(sf::seconds(Config::ConfigReloadInterval))) {
+        handleEvent(*event);
+        handleEvents();
+        m_idlePresentPending = true;
+    }
+    
+    // Also restarts the clock, so the first frame after resuming doesn't see the idle time
+    reloadRuntimeConfig(m_clock.restart().asSeconds());
+}
+
+void Game::presentIdleFrame() {
+    if (!m_idleFrameReady) {
+        render();
+        return;
+    }
+    
+    if (!m_idleFrameValid) {
+        renderScene(m_idleFrame);
+        m_idleFrame.display();
+        m_idleFrameValid = true;
+    }
+    m_window.clear();
+    m_window.draw(sf::Sprite(m_idleFrame.getTexture()));
+    m_window.display();
+}
+
+bool Game::openNetplay() {
+    const bool hosting = *m_options.coop == RollbackSession::Role::Host;
+    if (!m_transport.open(hosting ? m_options.port : sf::Socket::AnyPort)) return false;
     
-    m_scoreText = std::make_unique<sf::Text>(font);
-    m_scoreText->setCharacterSize(24);
-    m_scoreText->setFillColor(sf::Color::White);
-    m_scoreText->setPosition(sf::Vector2f(Config::WindowWidth - 200, 20));
+    if (hosting) {
+        std::cout << "Hosting co-op on UDP port " << m_options.port << std::endl;
+    } else {
+        const std::optional<sf::IpAddress> address = sf::IpAddress::resolve(m_options.peerAddress);
+        if (!address) {
+            std::cerr << "Unknown co-op host: " << m_options.peerAddress << std::endl;
+            return false;
+        }
+        m_transport.setPeer(*address, m_options.port);
+        std::cout << "Joining co-op at " << m_options.peerAddress << ":" << m_options.port << std::endl;
+    }
+    
+    const LinkConditions& link = m_options.link;
+    m_transport.setConditions(link, std::random_device{}());
+    if (link.latency > 0.0f || link.jitter > 0.0f || link.loss > 0.0f) {
+        std::cout << "Simulating " << link.latency * 1000.0f << " ms latency, " << link.jitter * 1000.0f
+                  << " ms jitter and " << link.loss * 100.0f << "% loss on outgoing packets" << std::endl;
+    }
+    return true;
+}
+
+void Game::reloadRuntimeConfig(float deltaTime) {
+    m_configReloadTimer += deltaTime;
+    if (m_configReloadTimer < Config::ConfigReloadInterval) return;
+    
+    m_configReloadTimer = 0.0f;
+    if (m_runtimeConfig.reloadIfChanged()) {
+        applyRuntimeSettings();
+    }
+}
+
+void Game::applyRuntimeSettings() {
+    const RuntimeSettings& settings = m_runtimeConfig.getSettings();
+    
+    m_window.setFramerateLimit(settings.targetFPS);
+    m_idleFrameValid = false;
+    
+    // A co-op game keeps the host's settings until it ends
+    if (m_netplay) {
+        std::cout << "Settings change applies from the next co-op game" << std::endl;
+        return;
+    }
+    
+    // The simulation thread reads its settings every tick, so swap them while it's stopped
+    const bool wasRunning = stopSimulation();
+    finishRecording();
+    m_simulation.applySettings(settings);
+    if (wasRunning) {
+        startSimulation();
+    }
+}
+
+void Game::initializeUI() {
+    if (m_resources.isFontLoaded()) {
+        m_hud.setFont(&m_resources.getFont());
+    }
+    
+    m_widgets.score = m_hud.addText(sf::Vector2f(Config::WindowWidth - 200, 20), 24, sf::Color::White);
+    m_widgets.kills = m_hud.addText(sf::Vector2f(Config::WindowWidth - 200, 50), 24, sf::Color::Yellow);
+    m_widgets.enemyCount = m_hud.addText(sf::Vector2f(Config::WindowWidth - 200, 80), 24, sf::Color::Red);
+    m_widgets.fps = m_hud.addText(sf::Vector2f(10, Config::WindowHeight - 30), 20, sf::Color::Green);
+    m_widgets.debug = m_hud.addText(sf::Vector2f(10, 40), 16, sf::Color(128, 255, 128));
+    
+    // Title with a black shadow offset by 2px for visibility over the background
+    m_widgets.titleShadow = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 298, 102), 72, sf::Color::Black,
+                                          RenderLayer::Overlay, true);
+    m_widgets.title = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 300, 100), 72, sf::Color::White,
+                                    RenderLayer::Overlay, true);
+    m_hud.setText(m_widgets.titleShadow, "SPACE DEFENDER");
+    m_hud.setText(m_widgets.title, "SPACE DEFENDER");
+    
+    m_widgets.menu = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 200, 250), 24, sf::Color::White,
+                                   RenderLayer::Overlay);
+    m_hud.setText(m_widgets.menu,
+        "\n\n\n\n\n1 or ENTER - START GAME\n"
+        "2 - EXIT\n"
+        "M - TOGGLE SOUND\n\n"
+        "CONTROLS:\n"
+        "WASD or Arrow Keys - Movement\n"
+        "SPACE or Left Mouse - Shoot\n"
+        "ESC - Pause (co-op: leave game)\n"
+        "F5 / F9 - Quick Save / Load"
+    );
     
-    m_killText = std::make_unique<sf::Text>(font);
-    m_killText->setCharacterSize(24);
-    m_killText->setFillColor(sf::Color::Yellow);
-    m_killText->setPosition(sf::Vector2f(Config::WindowWidth - 200, 50));
+    m_widgets.pause = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 200, Config::WindowHeight / 2 - 50), 48,
+                                    sf::Color::White, RenderLayer::Overlay);
+    m_hud.setText(m_widgets.pause, "PAUSED\n\nPress ESC or P to Continue");
     
-    m_enemyCountText = std::make_unique<sf::Text>(font);
-    m_enemyCountText->setCharacterSize(24);
-    m_enemyCountText->setFillColor(sf::Color::Red);
-    m_enemyCountText->setPosition(sf::Vector2f(Config::WindowWidth - 200, 80));
+    m_widgets.gameOver = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 250, Config::WindowHeight / 2 - 150),
+                                       48, sf::Color::Red, RenderLayer::Overlay);
     
-    m_fpsText = std::make_unique<sf::Text>(font);
-    m_fpsText->setCharacterSize(20);
-    m_fpsText->setFillColor(sf::Color::Green);
-    m_fpsText->setPosition(sf::Vector2f(10, Config::WindowHeight - 30));
+    m_widgets.netplay = m_hud.addText(sf::Vector2f(Config::WindowWidth / 2 - 250, Config::WindowHeight / 2 - 24), 36,
+                                      sf::Color::White, RenderLayer::Overlay);
 }
 
 void Game::initializeGrid() {
@@ -141,49 +344,47 @@ void Game::initializeGrid() {
 }
 
 void Game::handleEvents() {
-    // FIXED: Properly handle optional event
-    while (const std::optional<sf::Event> eventOpt = m_window.pollEvent()) {
-        if (!eventOpt.has_value()) break;
-        
-        const sf::Event& event = eventOpt.value();
-        
-        if (event.is<sf::Event::Closed>()) {
-            m_window.close();
-        }
-        
-        if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
-            m_inputManager.keyPressed(keyPressed->code);
-            handleKeyPress(keyPressed->code);
-        }
-        
-        if (const auto* keyReleased = event.getIf<sf::Event::KeyReleased>()) {
-            m_inputManager.keyReleased(keyReleased->code);
-            
-            if (keyReleased->code == sf::Keyboard::Key::Space && m_activePlayer) {
-                m_activePlayer->setWantToShoot(false);
-            }
-        }
-        
-        if (event.is<sf::Event::FocusGained>() || event.is<sf::Event::FocusLost>()) {
-            m_inputManager.clearAll();
-        }
-        
-        if (const auto* mousePressed = event.getIf<sf::Event::MouseButtonPressed>()) {
-            m_inputManager.mousePressed(mousePressed->button);
-            if (m_currentState == GameState::Playing && m_activePlayer && m_activePlayer->isAlive()) {
-                if (mousePressed->button == sf::Mouse::Button::Left) {
-                    shootBullet();
-                }
-            }
-        }
-        
-        if (const auto* mouseButtonReleased = event.getIf<sf::Event::MouseButtonReleased>()) {
-            m_inputManager.mouseReleased(mouseButtonReleased->button);
+    while (const std::optional<sf::Event> event = m_window.pollEvent()) {
+        handleEvent(*event);
+    }
+}
+
+void Game::handleEvent(const sf::Event& event) {
+    if (event.is<sf::Event::Closed>()) {
+        m_window.close();
+    }
+    
+    if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        m_inputManager.keyPressed(keyPressed->code);
+        handleKeyPress(keyPressed->code);
+    }
+    
+    if (const auto* keyReleased = event.getIf<sf::Event::KeyReleased>()) {
+        m_inputManager.keyReleased(keyReleased->code);
+    }
+    
+    if (event.is<sf::Event::FocusGained>() || event.is<sf::Event::FocusLost>()) {
+        m_inputManager.clearAll();
+    }
+    
+    if (const auto* mousePressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        m_inputManager.mousePressed(mousePressed->button);
+        if (m_currentState == GameState::Playing && mousePressed->button == sf::Mouse::Button::Left) {
+            requestFire();
         }
     }
+    
+    if (const auto* mouseButtonReleased = event.getIf<sf::Event::MouseButtonReleased>()) {
+        m_inputManager.mouseReleased(mouseButtonReleased->button);
+    }
 }
 
 void Game::handleKeyPress(sf::Keyboard::Key key) {
+    if (key == sf::Keyboard::Key::F2) {
+        saveMemoryReport();
+        return;
+    }
+    
     switch (m_currentState) {
         case GameState::MainMenu:
             if (key == sf::Keyboard::Key::Num1 || key == sf::Keyboard::Key::Enter) {
@@ -196,11 +397,21 @@ void Game::handleKeyPress(sf::Keyboard::Key key) {
             break;
             
         case GameState::Playing:
-            if (key == sf::Keyboard::Key::Escape) {
+            if (key == sf::Keyboard::Key::Escape && m_options.coop) {
+                // The peer can't wait on a pause; it sees us time out and its game ends
+                m_currentState = GameState::MainMenu;
+                cleanup();
+            } else if (key == sf::Keyboard::Key::Escape) {
+                stopSimulation();
                 m_currentState = GameState::Paused;
-            } else if (key == sf::Keyboard::Key::Space && m_activePlayer) {
-                m_activePlayer->setWantToShoot(true);
-                shootBullet();
+            } else if (key == sf::Keyboard::Key::Space) {
+                requestFire();
+            } else if ((key == sf::Keyboard::Key::F5 || key == sf::Keyboard::Key::F9) && m_options.coop) {
+                std::cout << "Quick save and load are off in co-op" << std::endl;
+            } else if (key == sf::Keyboard::Key::F5) {
+                quickSave();
+            } else if (key == sf::Keyboard::Key::F9) {
+                quickLoad();
             } else if (key == sf::Keyboard::Key::M) {
                 m_audioSystem.setEnabled(!m_audioSystem.isEnabled());
                 std::cout << "Audio " << (m_audioSystem.isEnabled() ? "enabled" : "disabled") << std::endl;
@@ -216,6 +427,11 @@ void Game::handleKeyPress(sf::Keyboard::Key key) {
         case GameState::Paused:
             if (key == sf::Keyboard::Key::Escape || key == sf::Keyboard::Key::P) {
                 m_currentState = GameState::Playing;
+                startSimulation();
+            } else if (key == sf::Keyboard::Key::F5) {
+                quickSave();
+            } else if (key == sf::Keyboard::Key::F9) {
+                quickLoad();
             } else if (key == sf::Keyboard::Key::M) {
                 m_audioSystem.setEnabled(!m_audioSystem.isEnabled());
                 std::cout << "Audio " << (m_audioSystem.isEnabled() ? "enabled" : "disabled") << std::endl;
@@ -228,367 +444,355 @@ void Game::handleKeyPress(sf::Keyboard::Key key) {
             } else if (key == sf::Keyboard::Key::Num2 || key == sf::Keyboard::Key::M) {
                 m_currentState = GameState::MainMenu;
                 cleanup();
+            } else if (key == sf::Keyboard::Key::F9 && !m_options.coop) {
+                quickLoad();
             }
             break;
     }
 }
 
-void Game::startNewGame() {
-    cleanup();
-    
-    m_currentState = GameState::Playing;
-    m_score = 0;
-    m_enemiesKilled = 0;
-    m_enemySpawnTimer = 0.0f;
-    m_previousScore = -1;
-    m_previousKills = -1;
-    m_previousEnemyCount = 0;
-    m_performanceMonitor.reset();
-    
-    // Get player from pool
-    m_activePlayer = m_playerPool.acquire();
-    GAME_ASSERT(m_activePlayer != nullptr, "Failed to acquire player from pool");
-    
-    if (m_activePlayer) {
-        m_activePlayer->initialize(sf::Vector2f(Config::WindowWidth / 2,
-                                               Config::WindowHeight / 2));
-        
-        // Set player sprite if available
-        if (m_resources.hasTexture("player_ship")) {
-            m_activePlayer->setTexture(m_resources.getTexture("player_ship"), m_resources);
-            std::cout << "Player sprite enabled" << std::endl;
-        }
-    }
-    
-    // Spawn initial enemies
-    for (size_t i = 0; i < 2; ++i) {
-        spawnEnemy();
-    }
+void Game::quickSave() {
+    // Saves happen between ticks, so hold the simulation thread for the copy
+    const bool wasRunning = stopSimulation();
+    const auto start = std::chrono::steady_clock::now();
+    m_quickSave.clear();
+    m_simulation.save(m_quickSave);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (wasRunning) {
+        startSimulation();
+    }
+    
+    std::cout << "Quick save: " << m_quickSave.size() << " bytes in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us" << std::endl;
 }
 
-void Game::cleanup() {
-    // Return objects to pools
-    if (m_activePlayer) {
-        m_playerPool.release(m_activePlayer);
-        m_activePlayer = nullptr;
+void Game::quickLoad() {
+    if (m_quickSave.empty()) {
+        std::cout << "No quick save yet (F5 saves)" << std::endl;
+        return;
     }
     
-    for (auto* enemy : m_activeEnemies) {
-        m_enemyPool.release(enemy);
+    stopSimulation();
+    finishRecording();
+    const auto start = std::chrono::steady_clock::now();
+    if (!m_simulation.load(m_quickSave.data(), m_quickSave.size())) {
+        cleanup();
+        m_currentState = GameState::MainMenu;
+        return;
     }
-    m_activeEnemies.clear();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Quick load: " << m_quickSave.size() << " bytes in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us" << std::endl;
     
-    for (auto* bullet : m_activeBullets) {
-        m_bulletPool.release(bullet);
-    }
-    m_activeBullets.clear();
+    // Sounds that already played when the save was made stay quiet
+    m_playedSounds = m_simulation.getSounds();
+    publishSnapshot();
+    m_snapshots.update();
+    m_idleFrameValid = false;
     
-    m_particleSystem.clear();
-    m_inputManager.clearAll();
+    // A paused game stays paused on the loaded state
+    if (m_currentState != GameState::Paused) {
+        m_currentState = GameState::Playing;
+        startSimulation();
+    }
 }
 
-void Game::update(float deltaTime) {
-    if (m_currentState != GameState::Playing) return;
+void Game::beginRecording(uint32_t seed) {
+    if (m_options.recordPath.empty()) return;
+    
+    m_recording.seed = seed;
+    m_recording.settings = m_simulation.getSettings();
+    m_recording.assetMask = m_simulation.getAssets().presenceMask();
+    m_recording.frames.clear();
+    m_recordingActive = true;
+    std::cout << "Recording replay (seed " << seed << ") to " << m_options.recordPath << std::endl;
+}
+
+void Game::finishRecording() {
+    if (!m_recordingActive) return;
+    m_recordingActive = false;
     
-    // Update player
-    if (m_activePlayer && m_activePlayer->isAlive()) {
-        m_activePlayer->update(deltaTime);
-        m_activePlayer->updateMovement(m_inputManager, deltaTime);
-        
-        if (m_activePlayer->wantsToShoot() ||
-            m_inputManager.isMousePressed(sf::Mouse::Button::Left)) {
-            shootBullet();
-        }
-    } else if (m_activePlayer && !m_activePlayer->isAlive()) {
-        m_explosionManager.createExplosion(m_activePlayer->getPosition(), ExplosionAnimation::ExplosionType::Large);
-        m_particleSystem.emit(m_activePlayer->getPosition(), sf::Color::Cyan, 30);
-        m_audioSystem.playExplosion();
-        m_currentState = GameState::GameOver;
+    m_recording.finalTick = m_simulation.getTick();
+    m_recording.finalScore = m_simulation.getScore();
+    m_recording.finalKills = m_simulation.getEnemiesKilled();
+    if (m_recording.save(m_options.recordPath)) {
+        std::cout << "Replay saved: " << m_recording.frames.size() << " ticks to " << m_options.recordPath << std::endl;
+    }
+}
+
+void Game::reportAllocations() {
+    if (!AllocationTracker::isAvailable()) return;
+    std::cout << "Allocations after warm-up: " << m_warmTickAllocations.load() << " in ticks, "
+              << m_warmFrameAllocations.allocations << " in frames (" << m_warmFrameAllocations.bytes
+              << " bytes)" << std::endl;
+}
+
+void Game::updateMemoryReport() {
+    using Kind = MemoryReport::Kind;
+    m_resources.accountMemory(m_memory);
+    m_memory.set("Font glyph pages", Kind::Gpu, m_hud.glyphTextureBytes());
+    if (m_idleFrameReady) {
+        const sf::Vector2u size = m_idleFrame.getSize();
+        m_memory.set("Idle frame", Kind::Gpu, static_cast<size_t>(size.x) * size.y * 4);
+    }
+    m_memory.set("Sound buffers", Kind::Audio, m_audioSystem.sampleBytes());
+    
+    m_memory.set("Sprite batch", Kind::Cpu, m_spriteBatch.memoryBytes());
+    m_memory.set("HUD", Kind::Cpu, m_hud.memoryBytes());
+    m_memory.set("Frame arena", Kind::Cpu, m_frameArena.getStats().capacity);
+    m_memory.set("Quick save", Kind::Cpu, m_quickSave.capacity());
+    
+    // Only the front snapshot is ours to read; the other two grow to about the same size
+    const RenderSnapshot& snapshot = m_snapshots.front();
+    m_memory.set("Render snapshots", Kind::Cpu, snapshot.memoryBytes() * 3);
+    m_memory.merge(snapshot.memory);
+}
+
+void Game::saveMemoryReport() {
+    const std::string path = m_options.memoryReportPath.empty() ? Config::MemoryReportPath
+                                                                 : m_options.memoryReportPath;
+    m_memory.print(stdout);
+    std::fflush(stdout);
+    if (m_memory.write(path)) {
+        std::cout << "Memory report written to " << path << std::endl;
     }
+}
+
+void Game::endNetplay() {
+    if (!m_netplay) return;
+    m_netplay->printSummary();
+    m_netplay.reset();
+}
+
+void Game::startNewGame() {
+    cleanup();
     
-    // Update enemies
-    for (auto* enemy : m_activeEnemies) {
-        enemy->update(deltaTime);
-        enemy->updateAI(m_rng, deltaTime);
-        
-        // Make enemies face the player for better visual targeting
-        if (m_activePlayer && m_activePlayer->isAlive()) {
-            enemy->faceTarget(m_activePlayer->getPosition());
-            
-            if (enemy->canShoot()) {
-                enemyShoot(enemy);
-            }
+    m_currentState = GameState::Playing;
+    m_performanceMonitor.reset();
+    const uint32_t seed = m_options.seed ? *m_options.seed : std::random_device{}();
+    if (m_options.coop) {
+        // The game starts on the simulation thread once the peers agree on it
+        m_netplay = std::make_unique<RollbackSession>(m_simulation, m_transport, *m_options.coop);
+        if (*m_options.coop == RollbackSession::Role::Host) {
+            m_netplay->host(seed, m_runtimeConfig.getSettings());
         }
+    } else {
+        m_simulation.startNewGame(seed);
+        beginRecording(seed);
     }
-    
-    // Update bullets
-    for (auto* bullet : m_activeBullets) {
-        bullet->update(deltaTime);
+    m_playedSounds = {};
+    m_gameFrames = 0;
+    m_warmFrameAllocations = {};
+    m_warmTickAllocations = 0;
+    if (m_resources.hasTexture("player_ship")) {
+        std::cout << "Player sprite enabled" << std::endl;
     }
     
-    // Update particles and explosions
-    m_particleSystem.update(deltaTime);
-    m_explosionManager.update(deltaTime);
-    
-    // Handle collisions
-    checkCollisions();
-    
-    // Clean up dead objects and finished explosions
-    cleanupDeadObjects();
-    m_explosionManager.cleanup();
+    // The first frame shows the new game, not the end of the last one
+    publishSnapshot();
+    m_snapshots.update();
+    startSimulation();
+}
+
+void Game::cleanup() {
+    stopSimulation();
+    finishRecording();
+    endNetplay();
+    m_simulation.clear();
+    m_inputManager.clearAll();
     
-    // Spawn enemies
-    m_enemySpawnTimer += deltaTime;
-    if (m_enemySpawnTimer > Config::EnemySpawnCooldown &&
-        m_activeEnemies.size() < Config::MaxEnemies) {
-        spawnEnemy();
-        m_enemySpawnTimer = 0.0f;
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    m_sharedInput = {};
+    m_firePressed = false;
+}
+
+void Game::startSimulation() {
+    if (m_simulationRunning.exchange(true)) return;
+    m_simulationThread = std::thread(&Game::simulationLoop, this);
+}
+
+bool Game::stopSimulation() {
+    const bool wasRunning = m_simulationRunning.exchange(false);
+    if (m_simulationThread.joinable()) {
+        m_simulationThread.join();
     }
+    return wasRunning;
 }
 
-void Game::checkCollisions() {
-    for (auto* bullet : m_activeBullets) {
-        if (!bullet->isAlive()) continue;
-        
-        if (bullet->isPlayerBullet()) {
-            // Check against enemies
-            for (auto* enemy : m_activeEnemies) {
-                if (!enemy->isAlive()) continue;
-                
-                if (Utils::rectIntersects(bullet->getBounds(), enemy->getBounds())) {
-                    enemy->takeDamage(bullet->getDamage());
-                    bullet->setAlive(false);
-                    
-                    // Small explosion at bullet impact point
-                    m_explosionManager.createExplosion(bullet->getPosition(), ExplosionAnimation::ExplosionType::Small);
-                    
-                    m_audioSystem.playHit();
-                    
-                    if (!enemy->isAlive()) {
-                        m_score += enemy->getScoreValue();
-                        m_enemiesKilled++;
-                        
-                        // Create explosion based on enemy type
-                        ExplosionAnimation::ExplosionType explosionType;
-                        switch (enemy->getType()) {
-                            case EnemyType::BasicEnemy:
-                                explosionType = ExplosionAnimation::ExplosionType::Medium;
-                                break;
-                            case EnemyType::FastEnemy:
-                                explosionType = ExplosionAnimation::ExplosionType::Small;
-                                break;
-                            case EnemyType::HeavyEnemy:
-                                explosionType = ExplosionAnimation::ExplosionType::Large;
-                                break;
-                        }
-                        
-                        m_explosionManager.createExplosion(enemy->getPosition(), explosionType);
-                        m_particleSystem.emit(enemy->getPosition(), enemy->getColor(), 20);
-                        m_audioSystem.playExplosion();
-                    }
-                    break;
-                }
+void Game::simulationLoop() {
+    using Clock = std::chrono::steady_clock;
+    
+    // Tick at the profile's frame rate; an uncapped profile still ticks at the default rate
+    const RuntimeSettings& settings = m_simulation.getSettings();
+    const unsigned int tickRate = settings.targetFPS > 0 ? settings.targetFPS : Config::TargetFPS;
+    const auto tickLength = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / tickRate));
+    
+    try {
+        Clock::time_point last = Clock::now();
+        Clock::time_point next = last + tickLength;
+        while (m_simulationRunning.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_until(next);
+            const Clock::time_point now = Clock::now();
+            
+            // After a stall, carry on at the normal pace instead of catching up in a burst
+            next = std::max(next + tickLength, now);
+            
+            // Clamp delta time to prevent spiral of death
+            const float deltaTime = std::min(std::chrono::duration<float>(now - last).count(), settings.maxDeltaTime);
+            last = now;
+            
+            PlayerInput input = takeInput();
+            if (m_bot) {
+                input = m_bot->decide(m_simulation, m_netplay ? m_netplay->getLocalSlot() : 0);
             }
-        } else {
-            // Check against player
-            if (m_activePlayer && m_activePlayer->isAlive()) {
-                if (Utils::rectIntersects(bullet->getBounds(), m_activePlayer->getBounds())) {
-                    m_activePlayer->takeDamage(bullet->getDamage());
-                    bullet->setAlive(false);
-                    
-                    // Small explosion at bullet impact point
-                    m_explosionManager.createExplosion(bullet->getPosition(), ExplosionAnimation::ExplosionType::Small);
-                    
-                    m_particleSystem.emit(bullet->getPosition(), sf::Color::Red, 5);
-                    m_audioSystem.playHit();
+            const AllocationTracker::Scope tickScope;
+            if (m_netplay) {
+                // Fixed ticks on both peers; a late tick here shows up as the peer's rollback
+                m_netplay->advance(input);
+            } else {
+                m_simulation.step(input, deltaTime);
+            }
+            const AllocationTracker::Counts tickAllocations = tickScope.counts();
+            
+            // The recording is meant to grow, so it stays out of the tick's count
+            if (m_recordingActive) {
+                m_recording.frames.push_back({deltaTime, input});
+            }
+            publishSnapshot(tickAllocations);
+            
+            if (m_simulation.getTick() > Config::AllocationWarmupTicks && tickAllocations.allocations > 0) {
+                m_warmTickAllocations.fetch_add(tickAllocations.allocations, std::memory_order_relaxed);
+                if (m_options.allocationCheck) {
+                    std::cerr << "Allocation check failed: tick " << m_simulation.getTick() << " made "
+                              << tickAllocations.allocations << " allocations (" << tickAllocations.bytes
+                              << " bytes)" << std::endl;
+                    AllocationTracker::printSamples(std::this_thread::get_id(), tickAllocations.allocations);
+                    m_allocationCheckFailed = true;
+                    break;
                 }
             }
+            
+            // The window thread sees gameOver in the snapshot and stops this thread
+            if (m_netplay ? m_netplay->isFinished() : m_simulation.isGameOver()) break;
         }
     }
+    catch (const std::exception& e) {
+        std::cerr << "Simulation error: " << e.what() << std::endl;
+    }
 }
 
-void Game::cleanupDeadObjects() {
-    // Return dead enemies to pool
-    auto enemyEnd = std::partition(m_activeEnemies.begin(), m_activeEnemies.end(),
-        [](Enemy* e) { return e->isAlive(); });
-    for (auto it = enemyEnd; it != m_activeEnemies.end(); ++it) {
-        m_enemyPool.release(*it);
-    }
-    m_activeEnemies.erase(enemyEnd, m_activeEnemies.end());
-    
-    // Return dead bullets to pool
-    auto bulletEnd = std::partition(m_activeBullets.begin(), m_activeBullets.end(),
-        [](Bullet* b) { return b->isAlive(); });
-    for (auto it = bulletEnd; it != m_activeBullets.end(); ++it) {
-        m_bulletPool.release(*it);
+void Game::publishSnapshot(const AllocationTracker::Counts& tickAllocations) {
+    m_simulation.capture(m_snapshots.back());
+    m_snapshots.back().tickAllocations = tickAllocations;
+    if (m_netplay) {
+        m_netplay->capture(m_snapshots.back());
     }
-    m_activeBullets.erase(bulletEnd, m_activeBullets.end());
+    m_snapshots.publish();
 }
 
-void Game::spawnEnemy() {
-    if (m_activeEnemies.size() >= Config::MaxEnemies) return;
-    
-    Enemy* enemy = m_enemyPool.acquire();
-    if (!enemy) {
-        GAME_ASSERT(false, "Enemy pool exhausted!");
-        return;
+void Game::shareInput() {
+    PlayerInput input;
+    if (m_inputManager.isKeyPressed(sf::Keyboard::Key::Left) || m_inputManager.isKeyPressed(sf::Keyboard::Key::A)) {
+        input.move.x = -1.0f;
     }
-    
-    // Find spawn position away from player
-    float x = m_unitDist(m_rng) * Config::WindowWidth;
-    float y = m_unitDist(m_rng) * Config::WindowHeight;
-    
-    if (m_activePlayer) {
-        const sf::Vector2f& playerPos = m_activePlayer->getPosition();
-        constexpr float MinDistance = 150.0f;
-        constexpr float MinDistanceSquared = MinDistance * MinDistance;
-        
-        int attempts = 0;
-        while (Utils::distanceSquared(sf::Vector2f(x, y), playerPos) < MinDistanceSquared &&
-               attempts++ < 10) {
-            x = m_unitDist(m_rng) * Config::WindowWidth;
-            y = m_unitDist(m_rng) * Config::WindowHeight;
-        }
+    if (m_inputManager.isKeyPressed(sf::Keyboard::Key::Right) || m_inputManager.isKeyPressed(sf::Keyboard::Key::D)) {
+        input.move.x = 1.0f;
     }
-    
-    // Choose enemy type
-    EnemyType type;
-    const float rand = m_unitDist(m_rng);
-    if (rand < 0.5f) {
-        type = EnemyType::BasicEnemy;
-    } else if (rand < 0.8f) {
-        type = EnemyType::FastEnemy;
-    } else {
-        type = EnemyType::HeavyEnemy;
-    }
-    
-    enemy->initialize(sf::Vector2f(x, y), type, m_rng);
-    
-    // Set appropriate sprite based on enemy type
-    std::string spriteKey;
-    switch (type) {
-        case EnemyType::BasicEnemy:
-            spriteKey = "enemy_basic";
-            break;
-        case EnemyType::FastEnemy:
-            spriteKey = "enemy_fast";
-            break;
-        case EnemyType::HeavyEnemy:
-            spriteKey = "enemy_heavy";
-            break;
+    if (m_inputManager.isKeyPressed(sf::Keyboard::Key::Up) || m_inputManager.isKeyPressed(sf::Keyboard::Key::W)) {
+        input.move.y = -1.0f;
     }
-    
-    if (m_resources.hasTexture(spriteKey)) {
-        enemy->setTexture(m_resources.getTexture(spriteKey), m_resources);
+    if (m_inputManager.isKeyPressed(sf::Keyboard::Key::Down) || m_inputManager.isKeyPressed(sf::Keyboard::Key::S)) {
+        input.move.y = 1.0f;
     }
+    input.fire = m_inputManager.isKeyPressed(sf::Keyboard::Key::Space) ||
+                 m_inputManager.isMousePressed(sf::Mouse::Button::Left);
     
-    m_activeEnemies.push_back(enemy);
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    m_sharedInput = input;
 }
 
-void Game::shootBullet() {
-    if (!m_activePlayer || !m_activePlayer->canShoot()) return;
-    if (m_activeBullets.size() >= Config::MaxBullets) return;
-    
-    Bullet* bullet = m_bulletPool.acquire();
-    if (bullet) {
-        bullet->initialize(m_activePlayer->getShootPosition(),
-                         m_activePlayer->getShootDirection(), true);
-        
-        // Apply player bullet sprite if available
-        if (m_resources.hasTexture("player_bullet")) {
-            bullet->setTexture(m_resources.getTexture("player_bullet"), m_resources);
-        }
-        
-        m_activeBullets.push_back(bullet);
-        m_activePlayer->resetShootCooldown();
-        m_audioSystem.playShoot();
-    }
+void Game::requestFire() {
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    m_firePressed = true;
 }
 
-void Game::enemyShoot(Enemy* enemy) {
-    if (!enemy || !m_activePlayer || m_activeBullets.size() >= Config::MaxBullets) return;
-    
-    Bullet* bullet = m_bulletPool.acquire();
-    if (bullet) {
-        bullet->initialize(enemy->getCenteredShootPosition(m_activePlayer->getPosition()),
-                         enemy->getShootDirection(m_activePlayer->getPosition()), false);
-        
-        // Apply enemy bullet sprite based on enemy type
-        std::string bulletTextureKey;
-        switch (enemy->getType()) {
-            case EnemyType::BasicEnemy:
-            case EnemyType::FastEnemy:
-                bulletTextureKey = "enemy_bullet";
-                break;
-            case EnemyType::HeavyEnemy:
-                bulletTextureKey = "heavy_bullet";
-                break;
-        }
-        
-        if (m_resources.hasTexture(bulletTextureKey)) {
-            bullet->setTexture(m_resources.getTexture(bulletTextureKey), m_resources);
-        }
-        
-        m_activeBullets.push_back(bullet);
-        enemy->resetShootCooldown();
+PlayerInput Game::takeInput() {
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    PlayerInput input = m_sharedInput;
+    input.fire = input.fire || m_firePressed;
+    m_firePressed = false;
+    return input;
+}
+
+void Game::playSounds(const SoundCounters& sounds) {
+    // At most one of each per frame, however many ticks asked for it
+    if (sounds.shots != m_playedSounds.shots) {
         m_audioSystem.playShoot();
     }
+    if (sounds.hits != m_playedSounds.hits) {
+        m_audioSystem.playHit();
+    }
+    if (sounds.explosions != m_playedSounds.explosions) {
+        m_audioSystem.playExplosion();
+    }
+    m_playedSounds = sounds;
 }
 
 void Game::render() {
-    m_window.clear(sf::Color(10, 10, 30));
+    renderScene(m_window);
+    m_window.display();
+}
+
+void Game::renderScene(sf::RenderTarget& target) {
+    target.clear(sf::Color(10, 10, 30));
     
     switch (m_currentState) {
         case GameState::MainMenu:
-            renderMainMenu();
+            renderMainMenu(target);
             break;
             
         case GameState::Playing:
         case GameState::Paused:
-            renderGame();
+            renderGame(target);
             if (m_currentState == GameState::Paused) {
                 renderPauseOverlay();
             }
             break;
             
         case GameState::GameOver:
-            renderGame();
+            renderGame(target);
             renderGameOver();
             break;
     }
     
-    m_window.display();
+    // Backgrounds are drawn directly; everything else was queued above
+    m_spriteBatch.flush(target, m_frameArena);
 }
 
-void Game::renderGame() {
+void Game::renderGame(sf::RenderTarget& target) {
     // Draw background
     if (m_useBackgroundSprite && m_backgroundSprite) {
-        m_window.draw(*m_backgroundSprite);
+        target.draw(*m_backgroundSprite);
     } else {
         // Fallback to grid
-        m_window.draw(m_gridLines);
+        target.draw(m_gridLines);
     }
     
-    // Draw explosions first (behind everything except background)
-    m_explosionManager.draw(m_window);
-    
-    // Draw particles
-    m_particleSystem.draw(m_window);
-    
-    // Draw enemies
-    for (const auto* enemy : m_activeEnemies) {
-        enemy->draw(m_window);
-    }
+    // Explosions, particles, enemies, player and bullets, back to front
+    const RenderSnapshot& snapshot = m_snapshots.front();
+    Systems::draw(snapshot, m_spriteBatch);
+    Systems::drawDebugBounds(snapshot, m_spriteBatch);
     
-    // Draw player
-    if (m_activePlayer && m_activePlayer->isAlive()) {
-        m_activePlayer->draw(m_window);
-        m_activePlayer->drawHealthBar(m_window);
+    for (size_t slot = 0; slot < snapshot.playerCount; ++slot) {
+        if (snapshot.playerAlive[slot]) {
+            PlayerSystem::drawHealthBar(slot, snapshot.playerHealth[slot], m_spriteBatch);
+        }
     }
     
-    // Draw bullets
-    for (const auto* bullet : m_activeBullets) {
-        bullet->draw(m_window);
+    if (snapshot.netplay.active && !snapshot.netplay.connected) {
+        m_hud.setText(m_widgets.netplay, snapshot.netplay.localSlot == 0 ? "WAITING FOR PLAYER 2..."
+                                                                         : "CONNECTING TO HOST...");
+        m_hud.draw(m_widgets.netplay, m_spriteBatch);
     }
     
     // Draw UI
@@ -601,133 +805,99 @@ void Game::renderGame() {
 }
 
 void Game::renderUI() {
-    if (!m_resources.isFontLoaded()) return;
-    
-    // Only update text when values change
-    if (m_scoreText && m_score != m_previousScore) {
-        m_scoreText->setString("SCORE: " + std::to_string(m_score));
-        m_previousScore = m_score;
-    }
-    
-    if (m_killText && m_enemiesKilled != m_previousKills) {
-        m_killText->setString("KILLS: " + std::to_string(m_enemiesKilled));
-        m_previousKills = m_enemiesKilled;
-    }
-    
-    if (m_enemyCountText && m_activeEnemies.size() != m_previousEnemyCount) {
-        m_enemyCountText->setString("ENEMIES: " + std::to_string(m_activeEnemies.size()) + "/" +
-                                   std::to_string(Config::MaxEnemies));
-        m_previousEnemyCount = m_activeEnemies.size();
-    }
-    
-    if (m_scoreText) m_window.draw(*m_scoreText);
-    if (m_killText) m_window.draw(*m_killText);
-    if (m_enemyCountText) m_window.draw(*m_enemyCountText);
-    
-    // Update FPS display
-    if (m_fpsText) {
-        std::ostringstream oss;
-        oss << std::fixed << std::setprecision(1)
-            << "FPS: " << m_performanceMonitor.getAverageFPS();
-        m_fpsText->setString(oss.str());
-        m_window.draw(*m_fpsText);
-    }
+    const RenderSnapshot& snapshot = m_snapshots.front();
+    
+    // Widgets only rebuild their glyphs when the formatted text differs
+    m_hud.setText(m_widgets.score, m_text.clear().append("SCORE: ").append(snapshot.score).view());
+    m_hud.setText(m_widgets.kills, m_text.clear().append("KILLS: ").append(snapshot.enemiesKilled).view());
+    m_hud.setText(m_widgets.enemyCount, m_text.clear().append("ENEMIES: ").append(snapshot.enemies)
+                                            .append("/").append(m_runtimeConfig.getSettings().maxEnemies).view());
+    m_hud.setText(m_widgets.fps, m_text.clear().append("FPS: ").append(m_performanceMonitor.getAverageFPS(), 1)
+                                     .view());
+    
+    m_hud.draw(m_widgets.score, m_spriteBatch);
+    m_hud.draw(m_widgets.kills, m_spriteBatch);
+    m_hud.draw(m_widgets.enemyCount, m_spriteBatch);
+    m_hud.draw(m_widgets.fps, m_spriteBatch);
 }
 
 void Game::renderDebugInfo() {
-    if (!m_resources.isFontLoaded()) return;
-    
-    sf::Text debugText(m_resources.getFont());
-    debugText.setCharacterSize(16);
-    debugText.setFillColor(sf::Color(128, 255, 128));
-    debugText.setPosition(sf::Vector2f(10, 40));
-    
-    std::ostringstream oss;
-    oss << "== DEBUG INFO ==\n"
-        << "Bullets: " << m_activeBullets.size() << "/" << m_bulletPool.getStats().totalAllocated << "\n"
-        << "Enemies: " << m_activeEnemies.size() << "/" << m_enemyPool.getStats().totalAllocated << "\n"
-        << "Particles: " << m_particleSystem.getActiveCount() << "/" << Config::MaxParticles << "\n"
-        << "Pool Usage:\n"
-        << "  Bullet: " << std::fixed << std::setprecision(1) << (m_bulletPool.getUsageRatio() * 100) << "%\n"
-        << "  Enemy: " << (m_enemyPool.getUsageRatio() * 100) << "%\n"
-        << "Audio: " << (m_audioSystem.isEnabled() ? "ON" : "OFF");
-    
-    debugText.setString(oss.str());
-    m_window.draw(debugText);
+    const RenderSnapshot& snapshot = m_snapshots.front();
+    const World::Statistics& world = snapshot.world;
+    const Broadphase::Statistics& broadphase = snapshot.broadphase;
+    // Last frame's batch, since this one is still being filled
+    const SpriteBatch::Statistics& batch = m_spriteBatch.getStats();
+    const FrameArena::Statistics arena = m_frameArena.getStats();
+    const RuntimeSettings& settings = m_runtimeConfig.getSettings();
+    
+    m_text.clear()
+        .append("== DEBUG INFO ==\n")
+        .append("Bullets: ").append(snapshot.bullets).append("/").append(settings.maxBullets).append("\n")
+        .append("Enemies: ").append(snapshot.enemies).append("/").append(settings.maxEnemies).append("\n")
+        .append("Particles: ").append(snapshot.particles).append("/").append(snapshot.particleCapacity).append(" (")
+        .append(ParticleSystem::policyName(settings.particlePolicy)).append(", ").append(snapshot.particleEvictions)
+        .append(" evicted)\n")
+        .append("Entities: ").append(world.entityCount).append(" (peak ").append(world.peakEntities).append(", ")
+        .append(world.archetypeCount).append(" archetypes)\n")
+        .append("Bounds rebuilt: ").append(snapshot.boundsRebuilt).append("\n")
+        .append("Broadphase: ").append(snapshot.broadphaseMode == BroadphaseMode::SortAndSweep ? "sweep" : "brute")
+        .append(" (").append(broadphase.pairs).append(" pairs, ").append(broadphase.overlapTests)
+        .append(" tests, ").append(broadphase.sortMoves).append(" sort moves)\n")
+        .append("SIMD: ").append(Utils::Simd::isaName(Utils::Simd::activeIsa())).append("\n")
+        .append("Sprite batch: ").append(batch.drawCalls).append(" draw calls (").append(batch.items)
+        .append(" items, ").append(batch.vertices).append(" vertices)\n")
+        .append("HUD rebuilds: ").append(m_hud.getRebuildCount()).append("\n")
+        .append("Frame arena: ").append(arena.peak / 1024).append("/").append(arena.capacity / 1024)
+        .append(" KB peak (").append(arena.growths).append(" growths)\n")
+        .append("Allocations: ").append(snapshot.tickAllocations.allocations).append(" last tick, ")
+        .append(m_frameAllocations.allocations).append(" last frame (")
+        .append(AllocationTracker::isAvailable() ? "tracked" : "not tracked").append(")\n")
+        .append("Memory: GPU ").append(m_memory.total(MemoryReport::Kind::Gpu) / 1024).append(" KB, CPU ")
+        .append(m_memory.total(MemoryReport::Kind::Cpu) / 1024).append(" KB, audio ")
+        .append(m_memory.total(MemoryReport::Kind::Audio) / 1024).append(" KB (F2 for report)\n")
+        .append("Audio: ").append(m_audioSystem.isEnabled() ? "ON" : "OFF").append("\n");
+    if (snapshot.netplay.active) {
+        const RenderSnapshot::Netplay& netplay = snapshot.netplay;
+        m_text.append("Rollback: ").append(netplay.rollbackDepth).append(" ticks in ")
+            .append(netplay.resimulationMs, 2).append(" ms (max ").append(netplay.maxRollbackDepth)
+            .append(", ").append(netplay.stalls).append(" stalls)\n");
+    }
+    m_text.append("Profile: ").append(m_runtimeConfig.getActiveProfile());
+    
+    m_hud.setText(m_widgets.debug, m_text.view());
+    m_hud.draw(m_widgets.debug, m_spriteBatch);
 }
 
-void Game::renderMainMenu() {
+void Game::renderMainMenu(sf::RenderTarget& target) {
     // Draw main menu background if available
     if (m_useMainMenuBackground && m_mainMenuBackgroundSprite) {
-        m_window.draw(*m_mainMenuBackgroundSprite);
+        target.draw(*m_mainMenuBackgroundSprite);
     }
     
     if (!m_resources.isFontLoaded()) return;
     
     // Add semi-transparent overlay for better text readability over space background
     if (m_useMainMenuBackground) {
-        sf::RectangleShape overlay(sf::Vector2f(Config::WindowWidth, Config::WindowHeight));
-        overlay.setFillColor(sf::Color(0, 0, 0, 100)); // Semi-transparent black
-        m_window.draw(overlay);
-    }
-    
-    sf::Text title(m_resources.getFont());
-    title.setString("SPACE DEFENDER");
-    title.setCharacterSize(72);
-    title.setFillColor(sf::Color::White);
-    title.setStyle(sf::Text::Style::Bold); // Make title bold for better visibility
-    title.setPosition(sf::Vector2f(Config::WindowWidth / 2 - 300, 100));
-    
-    // Add subtle outline/shadow effect for title
-    sf::Text titleShadow = title;
-    titleShadow.setFillColor(sf::Color::Black);
-    titleShadow.setPosition(sf::Vector2f(Config::WindowWidth / 2 - 298, 102));
-    m_window.draw(titleShadow);
-    m_window.draw(title);
-    
-    sf::Text menu(m_resources.getFont());
-    menu.setString(
-        "\n\n\n\n\n1 or ENTER - START GAME\n"
-        "2 - EXIT\n"
-        "M - TOGGLE SOUND\n\n"
-        "CONTROLS:\n"
-        "WASD or Arrow Keys - Movement\n"
-        "SPACE or Left Mouse - Shoot\n"
-        "ESC - Pause"
-    );
-    menu.setCharacterSize(24);
-    menu.setFillColor(sf::Color::White);
-    menu.setPosition(sf::Vector2f(Config::WindowWidth / 2 - 200, 250));
-    m_window.draw(menu);
+        m_spriteBatch.drawRect(sf::FloatRect({0, 0}, {Config::WindowWidth, Config::WindowHeight}),
+                               sf::Color(0, 0, 0, 100), RenderLayer::Overlay);
+    }
+    
+    m_hud.draw(m_widgets.titleShadow, m_spriteBatch);
+    m_hud.draw(m_widgets.title, m_spriteBatch);
+    m_hud.draw(m_widgets.menu, m_spriteBatch);
 }
 
 void Game::renderPauseOverlay() {
-    sf::RectangleShape overlay(sf::Vector2f(Config::WindowWidth, Config::WindowHeight));
-    overlay.setFillColor(sf::Color(0, 0, 0, 128));
-    m_window.draw(overlay);
-    
-    if (m_resources.isFontLoaded()) {
-        sf::Text text(m_resources.getFont());
-        text.setString("PAUSED\n\nPress ESC or P to Continue");
-        text.setCharacterSize(48);
-        text.setFillColor(sf::Color::White);
-        text.setPosition(sf::Vector2f(Config::WindowWidth / 2 - 200, Config::WindowHeight / 2 - 50));
-        m_window.draw(text);
-    }
+    m_spriteBatch.drawRect(sf::FloatRect({0, 0}, {Config::WindowWidth, Config::WindowHeight}),
+                           sf::Color(0, 0, 0, 128), RenderLayer::Overlay);
+    m_hud.draw(m_widgets.pause, m_spriteBatch);
 }
 
 void Game::renderGameOver() {
-    sf::RectangleShape overlay(sf::Vector2f(Config::WindowWidth, Config::WindowHeight));
-    overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    m_window.draw(overlay);
+    m_spriteBatch.drawRect(sf::FloatRect({0, 0}, {Config::WindowWidth, Config::WindowHeight}),
+                           sf::Color(0, 0, 0, 180), RenderLayer::Overlay);
     
-    if (m_resources.isFontLoaded()) {
-        sf::Text text(m_resources.getFont());
-        text.setString("GAME OVER\n\nFINAL SCORE: " + std::to_string(m_score) +
-                      "\n\n1 or R - PLAY AGAIN\n2 or M - MAIN MENU");
-        text.setCharacterSize(48);
-        text.setFillColor(sf::Color::Red);
-        text.setPosition(sf::Vector2f(Config::WindowWidth / 2 - 250, Config::WindowHeight / 2 - 150));
-        m_window.draw(text);
-    }
-}
+    m_hud.setText(m_widgets.gameOver, m_text.clear().append("GAME OVER\n\nFINAL SCORE: ").append(m_snapshots.front().score)
+                                          .append("\n\n1 or R - PLAY AGAIN\n2 or M - MAIN MENU").view());
+    m_hud.draw(m_widgets.gameOver, m_spriteBatch);
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "Hud.hpp"
+#include "MemoryReport.hpp"
+#include <cmath>
+#include <cstdint>
+
+TextBuffer& TextBuffer::append(float value, int decimals) noexcept {
+    if (!std::isfinite(value)) return append("-");
+
+    int64_t scale = 1;
+    for (int i = 0; i < decimals; ++i) scale *= 10;
+
+    int64_t scaled = std::llround(static_cast<double>(value) * static_cast<double>(scale));
+    if (scaled < 0) {
+        append("-");
+        scaled = -scaled;
+    }
+    append(scaled / scale);
+    if (decimals > 0) {
+        append(".");
+        // Left-pad the fraction with zeros, e.g. 5 -> "05" for two decimals
+        const int64_t fraction = scaled % scale;
+        for (int64_t digit = scale / 10; digit > 1 && fraction < digit; digit /= 10) {
+            append("0");
+        }
+        append(fraction);
+    }
+    return *this;
+}
+
+void Hud::setFont(const sf::Font* font) noexcept {
+    m_font = font;
+    for (Widget& widget : m_widgets) {
+        widget.dirty = true;
+    }
+}
+
+Hud::WidgetId Hud::addText(const sf::Vector2f& position, unsigned int characterSize, sf::Color color,
+                           RenderLayer layer, bool bold) {
+    Widget widget;
+    widget.position = position;
+    widget.characterSize = characterSize;
+    widget.color = color;
+    widget.bold = bold;
+    widget.layer = layer;
+    m_widgets.push_back(std::move(widget));
+    return m_widgets.size() - 1;
+}
+
+void Hud::setText(WidgetId id, std::string_view text) {
+    Widget& widget = m_widgets[id];
+    if (std::string_view(widget.text.data(), widget.text.size()) == text) return;
+
+    // Grow geometrically, so a counter gaining a digit doesn't reallocate every time
+    if (text.size() > widget.text.capacity()) {
+        widget.text.reserve(std::max(text.size(), widget.text.capacity() * 2));
+        widget.vertices.reserve(widget.text.capacity() * 6);
+    }
+    widget.text.assign(text.begin(), text.end());
+    widget.dirty = true;
+}
+
+void Hud::draw(WidgetId id, SpriteBatch& batch) {
+    if (!m_font) return;
+
+    Widget& widget = m_widgets[id];
+    if (widget.dirty) {
+        rebuild(widget);
+    }
+    batch.drawTriangles(&m_font->getTexture(widget.characterSize), widget.vertices.data(), widget.vertices.size(),
+                        widget.layer);
+}
+
+void Hud::rebuild(Widget& widget) {
+    // Same layout rules as sf::Text without outline or italics
+    widget.vertices.clear();
+    widget.dirty = false;
+    m_rebuilds++;
+
+    const unsigned int size = widget.characterSize;
+    const float whitespace = m_font->getGlyph(U' ', size, widget.bold).advance;
+    const float lineSpacing = m_font->getLineSpacing(size);
+    constexpr float padding = 1.0f;
+
+    float x = 0.0f;
+    float y = static_cast<float>(size);
+    std::uint32_t previous = 0;
+    for (const char c : widget.text) {
+        const auto current = static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+        x += m_font->getKerning(previous, current, size, widget.bold);
+        previous = current;
+
+        switch (c) {
+            case ' ': x += whitespace; continue;
+            case '\t': x += whitespace * 4.0f; continue;
+            case '\n': y += lineSpacing; x = 0.0f; continue;
+            default: break;
+        }
+
+        const sf::Glyph& glyph = m_font->getGlyph(current, size, widget.bold);
+        const sf::Vector2f topLeft = widget.position + sf::Vector2f(x, y) + glyph.bounds.position -
+                                     sf::Vector2f(padding, padding);
+        const sf::Vector2f bottomRight = widget.position + sf::Vector2f(x, y) + glyph.bounds.position +
+                                         glyph.bounds.size + sf::Vector2f(padding, padding);
+        const sf::Vector2f uvMin = sf::Vector2f(glyph.textureRect.position) - sf::Vector2f(padding, padding);
+        const sf::Vector2f uvMax = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) +
+                                   sf::Vector2f(padding, padding);
+
+        const sf::Vertex corners[] = {
+            {topLeft, widget.color, uvMin},
+            {{bottomRight.x, topLeft.y}, widget.color, {uvMax.x, uvMin.y}},
+            {{topLeft.x, bottomRight.y}, widget.color, {uvMin.x, uvMax.y}},
+            {bottomRight, widget.color, uvMax},
+        };
+        widget.vertices.insert(widget.vertices.end(), {corners[0], corners[1], corners[2],
+                                                       corners[2], corners[1], corners[3]});
+
+        x += glyph.advance;
+    }
+}
+
+size_t Hud::memoryBytes() const noexcept {
+    size_t bytes = MemoryReport::capacityBytes(m_widgets);
+    for (const Widget& widget : m_widgets) {
+        bytes += MemoryReport::capacityBytes(widget.text, widget.vertices);
+    }
+    return bytes;
+}
+
+size_t Hud::glyphTextureBytes() const {
+    if (!m_font) return 0;
+
+    // Each character size has its own page, shared by every widget of that size
+    size_t bytes = 0;
+    for (size_t i = 0; i < m_widgets.size(); ++i) {
+        const unsigned int size = m_widgets[i].characterSize;
+        const bool counted = std::any_of(m_widgets.begin(), m_widgets.begin() + static_cast<std::ptrdiff_t>(i),
+                                         [size](const Widget& widget) { return widget.characterSize == size; });
+        if (!counted) {
+            const sf::Vector2u page = m_font->getTexture(size).getSize();
+            bytes += static_cast<size_t>(page.x) * page.y * 4;
+        }
+    }
+    return bytes;
+}
\ No newline at end of file
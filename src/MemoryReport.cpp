@@ -0,0 +1,78 @@
+#include "MemoryReport.hpp"
+#include <algorithm>
+#include <iostream>
+
+void MemoryReport::set(std::string_view subsystem, Kind kind, size_t bytes) {
+    for (Entry& entry : m_entries) {
+        if (entry.kind == kind && entry.subsystem == subsystem) {
+            entry.current = bytes;
+            entry.peak = std::max(entry.peak, bytes);
+            return;
+        }
+    }
+    m_entries.push_back({std::string(subsystem), kind, bytes, bytes});
+}
+
+void MemoryReport::merge(const MemoryReport& other) {
+    for (const Entry& entry : other.m_entries) {
+        set(entry.subsystem, entry.kind, entry.current);
+    }
+}
+
+size_t MemoryReport::total(Kind kind) const noexcept {
+    size_t bytes = 0;
+    for (const Entry& entry : m_entries) {
+        if (entry.kind == kind) bytes += entry.current;
+    }
+    return bytes;
+}
+
+const char* MemoryReport::kindName(Kind kind) noexcept {
+    switch (kind) {
+        case Kind::Gpu: return "GPU";
+        case Kind::Audio: return "audio";
+        case Kind::Cpu: break;
+    }
+    return "CPU";
+}
+
+void MemoryReport::print(std::FILE* out) const {
+    std::vector<const Entry*> sorted;
+    sorted.reserve(m_entries.size());
+    for (const Entry& entry : m_entries) {
+        sorted.push_back(&entry);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry* a, const Entry* b) {
+        return a->current > b->current;
+    });
+    
+    std::fprintf(out, "%-32s %-6s %12s %12s\n", "subsystem", "kind", "current KB", "peak KB");
+    for (const Entry* entry : sorted) {
+        std::fprintf(out, "%-32s %-6s %12.1f %12.1f\n", entry->subsystem.c_str(), kindName(entry->kind),
+                     static_cast<double>(entry->current) / 1024.0, static_cast<double>(entry->peak) / 1024.0);
+    }
+    
+    // Per-kind peaks are summed from the entries, so they can overstate the true combined peak
+    for (const Kind kind : {Kind::Gpu, Kind::Cpu, Kind::Audio}) {
+        size_t peak = 0;
+        for (const Entry& entry : m_entries) {
+            if (entry.kind == kind) peak += entry.peak;
+        }
+        std::fprintf(out, "%-32s %-6s %12.1f %12.1f\n", "Total", kindName(kind),
+                     static_cast<double>(total(kind)) / 1024.0, static_cast<double>(peak) / 1024.0);
+    }
+}
+
+bool MemoryReport::write(const std::string& path) const {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        std::cerr << "Failed to write memory report: " << path << std::endl;
+        return false;
+    }
+    print(file);
+    const bool written = std::fclose(file) == 0;
+    if (!written) {
+        std::cerr << "Failed to write memory report: " << path << std::endl;
+    }
+    return written;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "NetTransport.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+bool NetTransport::open(unsigned short port) {
+    if (m_socket.bind(port) != sf::Socket::Status::Done) {
+        std::cerr << "Failed to bind UDP port " << port << std::endl;
+        return false;
+    }
+    m_socket.setBlocking(false);
+    m_receiveBuffer.resize(sf::UdpSocket::MaxDatagramSize);
+    return true;
+}
+
+void NetTransport::setPeer(const sf::IpAddress& address, unsigned short port) {
+    m_peerAddress = address;
+    m_peerPort = port;
+}
+
+void NetTransport::setConditions(const LinkConditions& conditions, uint32_t seed) {
+    m_conditions = conditions;
+    m_rng.seed(seed);
+}
+
+void NetTransport::send(const void* data, size_t size) {
+    if (!m_peerAddress) return;
+    
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    if (m_conditions.loss > 0.0f && unit(m_rng) < m_conditions.loss) {
+        ++m_stats.dropped;
+        return;
+    }
+    
+    // Reuse buffers of packets already sent
+    std::vector<std::byte> buffer;
+    if (!m_spareBuffers.empty()) {
+        buffer = std::move(m_spareBuffers.back());
+        m_spareBuffers.pop_back();
+    }
+    buffer.resize(size);
+    std::memcpy(buffer.data(), data, size);
+    
+    const float delay = m_conditions.latency + m_conditions.jitter * unit(m_rng);
+    const auto sendAt = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(delay));
+    m_delayed.push_back({sendAt, std::move(buffer)});
+    update();
+}
+
+void NetTransport::update() {
+    const Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < m_delayed.size();) {
+        Delayed& packet = m_delayed[i];
+        if (packet.sendAt > now) {
+            ++i;
+            continue;
+        }
+        
+        if (m_socket.send(packet.data.data(), packet.data.size(), *m_peerAddress, m_peerPort) ==
+            sf::Socket::Status::Done) {
+            ++m_stats.sent;
+            m_stats.bytesSent += packet.data.size();
+        }
+        m_spareBuffers.push_back(std::move(packet.data));
+        packet = std::move(m_delayed.back());
+        m_delayed.pop_back();
+    }
+}
+
+bool NetTransport::receive(std::vector<std::byte>& packet, Sender& from) {
+    size_t received = 0;
+    std::optional<sf::IpAddress> address;
+    unsigned short port = 0;
+    if (m_socket.receive(m_receiveBuffer.data(), m_receiveBuffer.size(), received, address, port) !=
+        sf::Socket::Status::Done || !address) {
+        return false;
+    }
+    
+    from = {*address, port};
+    if (isPeer(from)) {
+        ++m_stats.received;
+    }
+    packet.assign(m_receiveBuffer.begin(), m_receiveBuffer.begin() + static_cast<std::ptrdiff_t>(received));
+    return true;
+}
\ No newline at end of file
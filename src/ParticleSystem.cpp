@@ -1,83 +1,163 @@
 #include "ParticleSystem.hpp"
-#include <SFML/Graphics/CircleShape.hpp>
+#include "UtilsSimd.hpp"
 #include <algorithm>
 
 ParticleSystem::ParticleSystem(std::mt19937& rng) : m_rng(rng) {
-    m_particles.positions.reserve(Config::MaxParticles);
-    m_particles.velocities.reserve(Config::MaxParticles);
-    m_particles.colors.reserve(Config::MaxParticles);
-    m_particles.lifetimes.reserve(Config::MaxParticles);
-    m_particles.maxLifetimes.reserve(Config::MaxParticles);
-    
-    m_vertices.setPrimitiveType(sf::PrimitiveType::Points);
-    m_vertices.resize(Config::MaxParticles);
 }
 
-void ParticleSystem::emit(const sf::Vector2f& position, const sf::Color& color, int count) noexcept {
-    const size_t available = Config::MaxParticles - m_particles.activeCount;
-    const size_t toAdd = std::min(static_cast<size_t>(count), available);
+void ParticleSystem::emit(World& world, const sf::Vector2f& position, const sf::Color& color, int count) {
+    size_t toAdd = std::min(static_cast<size_t>(std::max(count, 0)), m_capacity);
+    if (m_policy != ParticlePolicy::Drop) {
+        // The oldest particles are the most faded, so they make room for the new burst
+        while (m_activeCount + toAdd > m_capacity) {
+            const Entity oldest = popOldest(world);
+            if (oldest.isNull()) break;
+            world.destroy(oldest);
+            --m_activeCount;
+            ++m_evictions;
+        }
+    }
+    toAdd = std::min(toAdd, m_capacity > m_activeCount ? m_capacity - m_activeCount : 0);
+    if (m_policy == ParticlePolicy::Grow) {
+        growTo(world, m_activeCount + toAdd);
+    }
+    
+    const ShapeVisual visual{ShapeVisual::Kind::Circle, 2.0f, color, sf::Color::Transparent, 0.0f,
+                             RenderLayer::Particles};
     
+    // Angle then speed per particle keeps the rng sequence; directions come from one batch
+    m_angles.resize(toAdd);
+    m_speeds.resize(toAdd);
+    m_sines.resize(toAdd);
+    m_cosines.resize(toAdd);
     for (size_t i = 0; i < toAdd; ++i) {
-        if (m_particles.activeCount >= Config::MaxParticles) break;
-        
-        const float angle = m_angleDist(m_rng);
-        const float speed = m_speedDist(m_rng);
-        const sf::Vector2f velocity(std::cos(angle) * speed, std::sin(angle) * speed);
-        
-        if (m_particles.activeCount < m_particles.positions.size()) {
-            m_particles.positions[m_particles.activeCount] = position;
-            m_particles.velocities[m_particles.activeCount] = velocity;
-            m_particles.colors[m_particles.activeCount] = color;
-            m_particles.lifetimes[m_particles.activeCount] = 0.0f;
-            m_particles.maxLifetimes[m_particles.activeCount] = Config::ParticleLifetime;
-        } else {
-            m_particles.positions.push_back(position);
-            m_particles.velocities.push_back(velocity);
-            m_particles.colors.push_back(color);
-            m_particles.lifetimes.push_back(0.0f);
-            m_particles.maxLifetimes.push_back(Config::ParticleLifetime);
-        }
-        m_particles.activeCount++;
+        m_angles[i] = m_angleDist(m_rng);
+        m_speeds[i] = m_speedDist(m_rng);
+    }
+    Utils::Simd::sincos(m_angles.data(), m_sines.data(), m_cosines.data(), toAdd);
+    
+    for (size_t i = 0; i < toAdd; ++i) {
+        const sf::Vector2f velocity(m_cosines[i] * m_speeds[i], m_sines[i] * m_speeds[i]);
+        track(world.create(Transform{position, 0.0f}, Velocity{velocity}, Particle{0.0f, m_lifetime, color}, visual));
     }
+    m_activeCount += toAdd;
 }
 
-void ParticleSystem::update(float deltaTime) noexcept {
-    size_t writeIndex = 0;
+void ParticleSystem::reserve(World& world) {
+    // Grow starts with one chunk, or enough for the particles already alive after a load
+    growTo(world, m_policy == ParticlePolicy::Grow ? std::max(m_activeCount, size_t{1}) : m_capacity);
+}
+
+void ParticleSystem::growTo(World& world, size_t rows) {
+    if (rows <= m_reservedRows) return;
     
-    for (size_t i = 0; i < m_particles.activeCount; ++i) {
-        m_particles.lifetimes[i] += deltaTime;
-        
-        if (m_particles.lifetimes[i] < m_particles.maxLifetimes[i]) {
-            m_particles.positions[i] += m_particles.velocities[i] * deltaTime;
-            
-            const float lifeRatio = m_particles.lifetimes[i] / m_particles.maxLifetimes[i];
-            sf::Color color = m_particles.colors[i];
-            color.a = static_cast<std::uint8_t>(255 * (1.0f - lifeRatio));
-            m_particles.colors[i] = color;
-            
-            if (writeIndex != i) {
-                m_particles.positions[writeIndex] = m_particles.positions[i];
-                m_particles.velocities[writeIndex] = m_particles.velocities[i];
-                m_particles.colors[writeIndex] = m_particles.colors[i];
-                m_particles.lifetimes[writeIndex] = m_particles.lifetimes[i];
-                m_particles.maxLifetimes[writeIndex] = m_particles.maxLifetimes[i];
-            }
-            writeIndex++;
-        }
+    // Whole chunks, so a run of small bursts costs one reallocation per chunk
+    const size_t chunks = (rows + Config::ParticleChunkSize - 1) / Config::ParticleChunkSize;
+    m_reservedRows = std::min(chunks * Config::ParticleChunkSize, std::max(m_capacity, rows));
+    world.reserve<Transform, Velocity, Particle, ShapeVisual>(m_reservedRows);
+    m_angles.reserve(m_reservedRows);
+    m_speeds.reserve(m_reservedRows);
+    m_sines.reserve(m_reservedRows);
+    m_cosines.reserve(m_reservedRows);
+}
+
+void ParticleSystem::clear() noexcept {
+    m_activeCount = 0;
+    m_evictions = 0;
+    m_orderHead = 0;
+    m_orderCount = 0;
+}
+
+void ParticleSystem::setCapacity(size_t capacity) {
+    m_capacity = capacity;
+    resizeOrder();
+}
+
+void ParticleSystem::resizeOrder() {
+    if (m_order.size() == m_capacity) return;
+    
+    // Re-lay the ring oldest first; a smaller ring keeps the newest entries
+    std::vector<Entity> order(m_capacity);
+    const size_t kept = std::min(m_orderCount, m_capacity);
+    for (size_t i = 0; i < kept; ++i) {
+        order[i] = m_order[(m_orderHead + m_orderCount - kept + i) % m_order.size()];
     }
+    m_order = std::move(order);
+    m_orderHead = 0;
+    m_orderCount = kept;
+}
+
+void ParticleSystem::track(Entity particle) noexcept {
+    if (m_order.empty()) return;
     
-    m_particles.activeCount = writeIndex;
+    // A full ring with room left in the budget only holds expired entries at the head
+    if (m_orderCount == m_order.size()) {
+        m_orderHead = (m_orderHead + 1) % m_order.size();
+        --m_orderCount;
+    }
+    m_order[(m_orderHead + m_orderCount) % m_order.size()] = particle;
+    ++m_orderCount;
 }
 
-void ParticleSystem::draw(sf::RenderWindow& window) const noexcept {
-    for (size_t i = 0; i < m_particles.activeCount; ++i) {
-        sf::CircleShape particle(2.0f);
-        particle.setPosition(m_particles.positions[i] - sf::Vector2f(2.0f, 2.0f));
-        particle.setFillColor(m_particles.colors[i]);
-        window.draw(particle);
+Entity ParticleSystem::popOldest(const World& world) noexcept {
+    while (m_orderCount > 0) {
+        const Entity particle = m_order[m_orderHead];
+        m_orderHead = (m_orderHead + 1) % m_order.size();
+        --m_orderCount;
+        if (world.isAlive(particle)) return particle;
     }
+    return Entity{};
 }
 
-void ParticleSystem::clear() noexcept {
-    m_particles.activeCount = 0;
-}
\ No newline at end of file
+void ParticleSystem::save(BinaryWriter& writer) const {
+    // Laid out like writeVector() of the ring unrolled oldest first
+    writer.write(static_cast<uint64_t>(m_activeCount));
+    writer.write(static_cast<uint64_t>(m_orderCount));
+    for (size_t i = 0; i < m_orderCount; ++i) {
+        writer.write(m_order[(m_orderHead + i) % m_order.size()]);
+    }
+}
+
+bool ParticleSystem::load(BinaryReader& reader) {
+    uint64_t activeCount = 0;
+    std::vector<Entity> order;
+    if (!reader.read(activeCount) || !reader.readVector(order)) return false;
+    
+    m_activeCount = static_cast<size_t>(activeCount);
+    m_evictions = 0;
+    m_orderCount = order.size();
+    m_orderHead = 0;
+    m_order = std::move(order);
+    resizeOrder();
+    return true;
+}
+
+const char* ParticleSystem::policyName(ParticlePolicy policy) noexcept {
+    switch (policy) {
+        case ParticlePolicy::Drop: return "drop";
+        case ParticlePolicy::Grow: return "grow";
+        case ParticlePolicy::EvictOldest: break;
+    }
+    return "evict";
+}
+
+void ParticleSystem::update(World& world, float deltaTime) noexcept {
+    size_t survivors = 0;
+    
+    world.each<Particle, ShapeVisual>([&](Entity entity, Particle& particle, ShapeVisual& visual) {
+        if (!world.isAlive(entity)) return;
+        
+        particle.age += deltaTime;
+        if (particle.age >= particle.lifetime || survivors >= m_capacity) {
+            world.destroyLater(entity);
+            return;
+        }
+        
+        const float lifeRatio = particle.age / particle.lifetime;
+        visual.fill = particle.color;
+        visual.fill.a = static_cast<std::uint8_t>(255 * (1.0f - lifeRatio));
+        survivors++;
+    });
+    
+    m_activeCount = survivors;
+}
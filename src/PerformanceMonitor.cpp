@@ -7,10 +7,9 @@ void PerformanceMonitor::update(float deltaTime) noexcept {
     m_updateTimer += deltaTime;
     
     // Store frame time for rolling average
-    m_frameTimes.push_back(deltaTime);
-    if (m_frameTimes.size() > Config::FPSSampleSize) {
-        m_frameTimes.pop_front();
-    }
+    m_frameTimes[m_nextFrameTime] = deltaTime;
+    m_nextFrameTime = (m_nextFrameTime + 1) % m_frameTimes.size();
+    m_frameTimeCount = std::min(m_frameTimeCount + 1, m_frameTimes.size());
     
     // Update stats periodically
     if (m_updateTimer >= Config::PerformanceUpdateInterval) {
@@ -18,11 +17,11 @@ void PerformanceMonitor::update(float deltaTime) noexcept {
         
         // Calculate average FPS
         float sum = 0.0f;
-        for (float ft : m_frameTimes) {
-            sum += ft;
+        for (size_t i = 0; i < m_frameTimeCount; ++i) {
+            sum += m_frameTimes[i];
         }
-        m_averageFPS = m_frameTimes.empty() ? 0.0f :
-                      m_frameTimes.size() / sum;
+        m_averageFPS = m_frameTimeCount == 0 ? 0.0f :
+                      m_frameTimeCount / sum;
         
         // Update min/max
         m_minFPS = std::min(m_minFPS, m_currentFPS);
@@ -33,7 +32,8 @@ void PerformanceMonitor::update(float deltaTime) noexcept {
 }
 
 void PerformanceMonitor::reset() noexcept {
-    m_frameTimes.clear();
+    m_frameTimeCount = 0;
+    m_nextFrameTime = 0;
     m_accumulatedTime = 0.0f;
     m_updateTimer = 0.0f;
     m_currentFPS = 0.0f;
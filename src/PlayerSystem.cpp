@@ -0,0 +1,122 @@
+#include "PlayerSystem.hpp"
+#include "Config.hpp"
+#include "Utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+    // Sprite tint and fallback hull colour for each co-op slot
+    struct ShipColors {
+        sf::Color tint;
+        sf::Color hull;
+    };
+    
+    constexpr ShipColors SlotColors[] = {
+        {sf::Color::White, sf::Color::Cyan},
+        {sf::Color(255, 190, 120), sf::Color(255, 160, 40)},
+    };
+}
+
+namespace PlayerSystem {
+    Entity spawn(World& world, const sf::Vector2f& position, float shootCooldown, const sf::Texture* texture,
+                 size_t slot) {
+        const ShipColors& colors = SlotColors[slot % std::size(SlotColors)];
+        const Transform transform{position, 0.0f};
+        const Health health{Config::PlayerMaxHealth, Config::PlayerMaxHealth};
+        const Weapon weapon{shootCooldown, 0.0f};
+        const sf::Color debugColor(0, 255, 0, 192); // Bright green for player
+        
+        if (texture) {
+            const sf::Vector2f size(Config::PlayerSpriteSize, Config::PlayerSpriteSize);
+            SpriteVisual visual = SpriteVisual::fit(*texture, size, RenderLayer::Player, Config::SpriteOrientationOffset);
+            visual.color = colors.tint;
+            return world.create(transform, health, weapon, PlayerControl{},
+                                Collider{size, Config::SpriteBoundsTightnessRatio, true, debugColor}, Bounds{},
+                                visual);
+        }
+        
+        // Geometric fallback: 30x20 arrowhead plus its 2px outline
+        const ShapeVisual ship{ShapeVisual::Kind::Ship, 20.0f, colors.hull, sf::Color::White, 2.0f, RenderLayer::Player};
+        return world.create(transform, health, weapon, PlayerControl{},
+                            Collider{sf::Vector2f(34.0f, 24.0f), Config::SpriteBoundsTightnessRatio, true, debugColor},
+                            Bounds{},
+                            ship);
+    }
+    
+    void update(World& world, Entity player, const PlayerInput& input, float deltaTime) noexcept {
+        Transform* transform = world.get<Transform>(player);
+        Weapon* weapon = world.get<Weapon>(player);
+        if (!transform || !weapon) return;
+        
+        weapon->timer = std::max(0.0f, weapon->timer - deltaTime);
+        if (PlayerControl* control = world.get<PlayerControl>(player)) {
+            control->wantToShoot = input.fire;
+        }
+        
+        sf::Vector2f movement = input.move * Config::PlayerSpeed;
+        if (input.move.lengthSquared() > 1.0f) {
+            movement = Utils::normalize(input.move) * Config::PlayerSpeed;
+        }
+        
+        sf::Vector2f& position = transform->position;
+        position += movement * deltaTime;
+        position.x = Utils::clamp(position.x, Config::PlayerBoundsMargin,
+                                  Config::WindowWidth - Config::PlayerBoundsMargin);
+        position.y = Utils::clamp(position.y, Config::PlayerBoundsMargin,
+                                  Config::WindowHeight - Config::PlayerBoundsMargin);
+        
+        if (movement.x != 0 || movement.y != 0) {
+            transform->rotation = Utils::radToDeg(std::atan2(movement.y, movement.x));
+        }
+    }
+    
+    sf::Vector2f getShootDirection(const Transform& transform) noexcept {
+        return sf::Vector2f(std::cos(Utils::degToRad(transform.rotation)),
+                           std::sin(Utils::degToRad(transform.rotation)));
+    }
+    
+    sf::Vector2f getShootPosition(World& world, Entity player) noexcept {
+        const Transform* transform = world.get<Transform>(player);
+        const Collider* collider = world.get<Collider>(player);
+        Bounds* bounds = world.get<Bounds>(player);
+        if (!transform || !collider || !bounds) return {};
+        
+        // The player moved this tick, after the last bounds pass
+        bounds->refresh(*transform, *collider);
+        
+        // Position is the sprite centre; spawn just outside its edge
+        if (const SpriteVisual* sprite = world.get<SpriteVisual>(player)) {
+            const sf::FloatRect& spriteBounds = bounds->visual;
+            const float spriteRadius = std::max(spriteBounds.size.x, spriteBounds.size.y) * 0.5f;
+            
+            // The sprite's visual orientation differs from the logical shooting direction
+            const float visualRotation = transform->rotation + sprite->rotationOffset;
+            const sf::Vector2f visualShootDirection(std::cos(Utils::degToRad(visualRotation)),
+                                                    std::sin(Utils::degToRad(visualRotation)));
+            return transform->position + visualShootDirection * (spriteRadius + 5.0f);
+        }
+        
+        // For geometric shape, use the logical shooting direction
+        const sf::FloatRect& tightBounds = bounds->collision;
+        const float spriteRadius = std::max(tightBounds.size.x, tightBounds.size.y) * 0.5f;
+        return transform->position + getShootDirection(*transform) * (spriteRadius + 5.0f);
+    }
+    
+    void drawHealthBar(size_t slot, float ratio, SpriteBatch& batch) {
+        const float top = 8.0f + 30.0f * static_cast<float>(slot);
+        
+        // White behind the grey bar gives it a 2px outline
+        batch.drawRect(sf::FloatRect({8.0f, top}, {204.0f, 24.0f}), sf::Color::White, RenderLayer::Hud);
+        batch.drawRect(sf::FloatRect({10.0f, top + 2.0f}, {200.0f, 20.0f}), sf::Color(50, 50, 50), RenderLayer::Hud);
+        
+        const float healthPercentage = ratio;
+        sf::Color fill = sf::Color::Red;
+        if (healthPercentage > 0.6f) {
+            fill = sf::Color::Green;
+        } else if (healthPercentage > 0.3f) {
+            fill = sf::Color::Yellow;
+        }
+        batch.drawRect(sf::FloatRect({12.0f, top + 4.0f}, {196.0f * healthPercentage, 16.0f}), fill, RenderLayer::Hud);
+    }
+}
@@ -0,0 +1,103 @@
+#include "Replay.hpp"
+#include "BinaryStream.hpp"
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+namespace {
+    constexpr uint32_t ReplayMagic = 0x50524453;   // "SDRP"
+    
+    // RuntimeSettings as versions 1 and 2 wrote it, raw; frozen so later fields can't shift it
+    struct LegacySettings {
+        unsigned int targetFPS;
+        float maxDeltaTime;
+        size_t maxEnemies;
+        float enemySpawnCooldown;
+        size_t maxBullets;
+        float playerShootCooldown;
+        size_t maxParticles;
+        float particleLifetime;
+        size_t bulletPoolSize;
+        size_t enemyPoolSize;
+        BroadphaseMode broadphase;
+        ParticlePolicy particlePolicy;   // Version 2 only; version 1 left padding here
+    };
+    
+    bool readLegacySettings(BinaryReader& reader, uint32_t version, RuntimeSettings& settings) {
+        LegacySettings legacy{};
+        if (!reader.read(legacy)) return false;
+        settings.targetFPS = legacy.targetFPS;
+        settings.maxDeltaTime = legacy.maxDeltaTime;
+        settings.maxEnemies = legacy.maxEnemies;
+        settings.enemySpawnCooldown = legacy.enemySpawnCooldown;
+        settings.maxBullets = legacy.maxBullets;
+        settings.playerShootCooldown = legacy.playerShootCooldown;
+        settings.maxParticles = legacy.maxParticles;
+        settings.particleLifetime = legacy.particleLifetime;
+        settings.bulletPoolSize = legacy.bulletPoolSize;
+        settings.enemyPoolSize = legacy.enemyPoolSize;
+        settings.broadphase = legacy.broadphase;
+        settings.particlePolicy = version == 1 ? ParticlePolicy::Drop : legacy.particlePolicy;
+        return true;
+    }
+}
+
+bool Replay::save(const std::string& path) const {
+    std::vector<std::byte> buffer;
+    BinaryWriter writer(buffer);
+    writer.write(ReplayMagic);
+    writer.write(Version);
+    writer.write(seed);
+    settings.save(writer);
+    writer.write(assetMask);
+    writer.write(finalTick);
+    writer.write(finalScore);
+    writer.write(finalKills);
+    writer.writeVector(frames);
+    
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()))) {
+        std::cerr << "Failed to write replay: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool Replay::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open replay: " << path << std::endl;
+        return false;
+    }
+    const std::vector<char> contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    
+    BinaryReader reader(reinterpret_cast<const std::byte*>(contents.data()), contents.size());
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!reader.read(magic) || !reader.read(version) || magic != ReplayMagic || version < 1 || version > Version) {
+        std::cerr << "Replay rejected: " << path << " is not a version 1 to " << Version << " replay" << std::endl;
+        return false;
+    }
+    
+    Replay replay;
+    reader.read(replay.seed);
+    const bool settingsRead = version < 3 ? readLegacySettings(reader, version, replay.settings)
+                                          : replay.settings.load(reader);
+    reader.read(replay.assetMask);
+    reader.read(replay.finalTick);
+    reader.read(replay.finalScore);
+    reader.read(replay.finalKills);
+    reader.readVector(replay.frames);
+    if (!settingsRead || !reader.ok() || reader.remaining() != 0) {
+        std::cerr << "Replay rejected: " << path << " is truncated or corrupt" << std::endl;
+        return false;
+    }
+    if (!RuntimeConfig::validate(replay.settings)) {
+        std::cerr << "Replay rejected: " << path << " has settings out of range" << std::endl;
+        return false;
+    }
+    
+    *this = std::move(replay);
+    return true;
+}
\ No newline at end of file
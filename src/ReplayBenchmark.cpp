@@ -0,0 +1,276 @@
+#include "ReplayBenchmark.hpp"
+#include "AllocationTracker.hpp"
+#include "MemoryReport.hpp"
+#include "Config.hpp"
+#include "Replay.hpp"
+#include "Simulation.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <thread>
+
+namespace {
+    constexpr size_t PhaseCount = static_cast<size_t>(Simulation::Phase::Count);
+    constexpr size_t TotalRow = PhaseCount;     // Rows are the phases, then the whole tick
+    
+    // Microseconds per tick for each row
+    using Timings = std::array<double, PhaseCount + 1>;
+    
+    struct Baseline {
+        uint64_t ticks = 0;
+        double threshold = 0.10;
+        double noiseFloor = 0.25;
+        std::map<std::string, double> values;   // Row timings and "<Row>.Threshold" overrides
+    };
+    
+    const char* rowName(size_t row) noexcept {
+        return row == TotalRow ? "Total" : Simulation::phaseName(static_cast<Simulation::Phase>(row));
+    }
+    
+    std::string trim(const std::string& text) {
+        const auto first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return "";
+        const auto last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+    
+    bool readBaseline(const std::string& path, Baseline& baseline) {
+        std::ifstream file(path);
+        if (!file) return false;
+        
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty()) continue;
+            
+            const auto equals = line.find('=');
+            const std::string key = trim(line.substr(0, equals));
+            const std::string text = equals == std::string::npos ? "" : trim(line.substr(equals + 1));
+            char* end = nullptr;
+            const double value = std::strtod(text.c_str(), &end);
+            if (text.empty() || *end != '\0') {
+                std::cerr << path << ":" << lineNumber << ": expected 'key = number'" << std::endl;
+                continue;
+            }
+            
+            if (key == "Ticks") baseline.ticks = static_cast<uint64_t>(value);
+            else if (key == "Threshold") baseline.threshold = value;
+            else if (key == "NoiseFloor") baseline.noiseFloor = value;
+            else baseline.values[key] = value;
+        }
+        return true;
+    }
+    
+    // Keeps the thresholds of the baseline being replaced
+    bool writeBaseline(const std::string& path, const Baseline& previous, const std::string& replayPath,
+                       uint64_t ticks, const Timings& timings) {
+        std::ofstream file(path, std::ios::trunc);
+        file << "# Replay baseline for " << replayPath << ", written with --write-baseline\n";
+        file << "Ticks = " << ticks << "\n";
+        file << "Threshold = " << previous.threshold << "\n";
+        file << "NoiseFloor = " << previous.noiseFloor << "\n";
+        for (size_t row = 0; row <= TotalRow; ++row) {
+            const auto custom = previous.values.find(std::string(rowName(row)) + ".Threshold");
+            if (custom != previous.values.end()) {
+                file << custom->first << " = " << custom->second << "\n";
+            }
+        }
+        file << "\n# Microseconds per tick\n";
+        for (size_t row = 0; row <= TotalRow; ++row) {
+            file << rowName(row) << " = " << timings[row] << "\n";
+        }
+        
+        if (!file.flush()) {
+            std::cerr << "Failed to write baseline: " << path << std::endl;
+            return false;
+        }
+        std::cout << "Baseline written to " << path << std::endl;
+        return true;
+    }
+    
+    // One full-speed playback; false if the game ended differently from the recording
+    // allocations counts the heap use of the ticks after warm-up
+    bool play(const Replay& replay, Simulation& simulation, Timings& timings, double& seconds,
+              AllocationTracker::Counts& allocations) {
+        simulation.applySettings(replay.settings);
+        simulation.setAssets(SimulationAssets::placeholders(replay.assetMask));
+        simulation.startNewGame(replay.seed);
+        simulation.setProfiling(false);
+        simulation.setProfiling(true);
+        
+        const auto start = std::chrono::steady_clock::now();
+        AllocationTracker::Counts warmStart;
+        for (const ReplayFrame& frame : replay.frames) {
+            if (simulation.getTick() == Config::AllocationWarmupTicks) {
+                warmStart = AllocationTracker::threadCounts();
+            }
+            simulation.step(frame.input, frame.deltaTime);
+        }
+        if (simulation.getTick() > Config::AllocationWarmupTicks) {
+            allocations = AllocationTracker::threadCounts() - warmStart;
+        }
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        simulation.setProfiling(false);
+        
+        const Simulation::PhaseTimes& times = simulation.getPhaseTimes();
+        const double ticks = static_cast<double>(std::max<uint64_t>(times.ticks, 1));
+        timings[TotalRow] = 0.0;
+        for (size_t row = 0; row < PhaseCount; ++row) {
+            timings[row] = times.seconds[row] * 1e6 / ticks;
+            timings[TotalRow] += timings[row];
+        }
+        
+        if (simulation.getTick() != replay.finalTick || simulation.getScore() != replay.finalScore ||
+            simulation.getEnemiesKilled() != replay.finalKills) {
+            std::cerr << "Replay desynced: ended at tick " << simulation.getTick() << " with score "
+                      << simulation.getScore() << " and " << simulation.getEnemiesKilled()
+                      << " kills, recorded tick " << replay.finalTick << " with score " << replay.finalScore
+                      << " and " << replay.finalKills << " kills" << std::endl;
+            return false;
+        }
+        return true;
+    }
+    
+    // An untimed playback that stops at the first warmed-up tick that allocates
+    // and shows where its allocations came from
+    bool checkAllocations(const Replay& replay, Simulation& simulation) {
+        simulation.applySettings(replay.settings);
+        simulation.setAssets(SimulationAssets::placeholders(replay.assetMask));
+        simulation.startNewGame(replay.seed);
+        
+        AllocationTracker::setSampleInterval(1);
+        bool passed = true;
+        for (const ReplayFrame& frame : replay.frames) {
+            const AllocationTracker::Scope tick;
+            simulation.step(frame.input, frame.deltaTime);
+            const AllocationTracker::Counts counts = tick.counts();
+            if (simulation.getTick() > Config::AllocationWarmupTicks && counts.allocations > 0) {
+                std::cerr << "Allocation check failed: tick " << simulation.getTick() << " made "
+                          << counts.allocations << " allocations (" << counts.bytes << " bytes)" << std::endl;
+                AllocationTracker::printSamples(std::this_thread::get_id(), counts.allocations);
+                passed = false;
+                break;
+            }
+        }
+        AllocationTracker::setSampleInterval(0);
+        return passed;
+    }
+}
+
+int ReplayBenchmark::run(const Options& options) {
+    Replay replay;
+    if (!replay.load(options.replayPath)) return 2;
+    if (replay.frames.empty()) {
+        std::cerr << "Replay " << options.replayPath << " has no frames" << std::endl;
+        return 2;
+    }
+    
+    Simulation simulation;
+    if (options.allocationCheck) {
+        if (!AllocationTracker::isAvailable()) {
+            std::cerr << "--alloc-check needs a build with SPACEDEFENDER_TRACK_ALLOCATIONS" << std::endl;
+            return 2;
+        }
+        if (!checkAllocations(replay, simulation)) return 1;
+    }
+    
+    // Each phase keeps its fastest run, which filters out most scheduler noise
+    Timings best;
+    best.fill(std::numeric_limits<double>::max());
+    double bestSeconds = std::numeric_limits<double>::max();
+    AllocationTracker::Counts allocations;      // Same every run; the game is deterministic
+    const int repeat = std::max(options.repeat, 1);
+    for (int run = 0; run < repeat; ++run) {
+        Timings timings{};
+        double seconds = 0.0;
+        if (!play(replay, simulation, timings, seconds, allocations)) return 2;
+        
+        for (size_t row = 0; row <= TotalRow; ++row) {
+            best[row] = std::min(best[row], timings[row]);
+        }
+        bestSeconds = std::min(bestSeconds, seconds);
+    }
+    
+    const uint64_t ticks = replay.frames.size();
+    std::printf("Replay %s: %llu ticks, seed %u, best of %d\n", options.replayPath.c_str(),
+                static_cast<unsigned long long>(ticks), replay.seed, repeat);
+    const unsigned int tickRate = replay.settings.targetFPS > 0 ? replay.settings.targetFPS : Config::TargetFPS;
+    std::printf("%.0f ticks/s (%.1fx real time)\n", static_cast<double>(ticks) / bestSeconds,
+                static_cast<double>(ticks) / bestSeconds / tickRate);
+    MemoryReport memory;
+    simulation.accountMemory(memory);
+    std::printf("Simulation memory: %.1f KB\n", static_cast<double>(memory.total(MemoryReport::Kind::Cpu)) / 1024.0);
+    if (AllocationTracker::isAvailable()) {
+        std::printf("%llu allocations (%llu bytes) after the first %u ticks\n",
+                    static_cast<unsigned long long>(allocations.allocations),
+                    static_cast<unsigned long long>(allocations.bytes), Config::AllocationWarmupTicks);
+    }
+    
+    Baseline baseline;
+    const bool haveBaseline = !options.baselinePath.empty() && readBaseline(options.baselinePath, baseline);
+    if (options.threshold >= 0.0f) {
+        baseline.threshold = options.threshold;
+    }
+    
+    if (options.writeBaseline || !haveBaseline) {
+        std::printf("\n%-12s %10s\n", "phase", "us/tick");
+        for (size_t row = 0; row <= TotalRow; ++row) {
+            std::printf("%-12s %10.3f\n", rowName(row), best[row]);
+        }
+        if (options.writeBaseline) {
+            if (options.baselinePath.empty()) {
+                std::cerr << "--write-baseline needs --baseline <file>" << std::endl;
+                return 2;
+            }
+            return writeBaseline(options.baselinePath, baseline, options.replayPath, ticks, best) ? 0 : 2;
+        }
+        if (!options.baselinePath.empty()) {
+            std::cerr << "Baseline not found: " << options.baselinePath << std::endl;
+            return 2;
+        }
+        return 0;
+    }
+    
+    if (baseline.ticks != ticks) {
+        std::cerr << "Baseline " << options.baselinePath << " was written for a " << baseline.ticks
+                  << " tick replay, not this one" << std::endl;
+        return 2;
+    }
+    
+    // A phase regresses when it is both past its threshold and slower by more than the noise floor
+    int regressions = 0;
+    std::printf("\n%-12s %10s %10s %9s\n", "phase", "us/tick", "baseline", "change");
+    for (size_t row = 0; row <= TotalRow; ++row) {
+        const std::string name = rowName(row);
+        const auto expected = baseline.values.find(name);
+        if (expected == baseline.values.end()) {
+            std::printf("%-12s %10.3f %10s\n", name.c_str(), best[row], "-");
+            continue;
+        }
+        
+        const auto custom = baseline.values.find(name + ".Threshold");
+        const double threshold = custom != baseline.values.end() ? custom->second : baseline.threshold;
+        const double base = expected->second;
+        const double change = base > 0.0 ? (best[row] - base) / base : 0.0;
+        const bool regressed = best[row] - base > baseline.noiseFloor && change > threshold;
+        regressions += regressed ? 1 : 0;
+        std::printf("%-12s %10.3f %10.3f %+8.1f%%%s\n", name.c_str(), best[row], base, change * 100.0,
+                    regressed ? "  REGRESSION" : "");
+    }
+    
+    if (regressions > 0) {
+        std::printf("\n%d phase(s) slower than the baseline allows\n", regressions);
+        return 1;
+    }
+    std::printf("\nWithin baseline (threshold %.0f%%, noise floor %.2f us)\n", baseline.threshold * 100.0,
+                baseline.noiseFloor);
+    return 0;
+}
\ No newline at end of file
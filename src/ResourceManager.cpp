@@ -76,21 +76,34 @@ bool ResourceManager::loadSystemFont() {
     return false;
 }
 
-bool ResourceManager::loadTexture(const std::string& name, const std::string& filePath) {
-    sf::Texture texture;
-    
+std::vector<std::string> ResourceManager::candidatePaths(const std::string& filePath) const {
     // Get the project root directory
     std::string projectRoot = findProjectRoot();
     std::string absolutePath = projectRoot + "/" + filePath;
     
     // Try the smart absolute path first, then fallbacks
-    std::vector<std::string> possiblePaths = {
+    return {
         absolutePath,                               // Smart absolute path from project root
         filePath,                                   // Original relative path
         "../" + filePath,                          // One level up (common for Xcode)
         "../../" + filePath,                       // Two levels up
         "../../../" + filePath,                    // Three levels up
     };
+}
+
+std::string ResourceManager::resolvePath(const std::string& filePath) const {
+    for (const auto& path : candidatePaths(filePath)) {
+        if (std::filesystem::exists(path)) {
+            return path;
+        }
+    }
+    return filePath;
+}
+
+bool ResourceManager::loadTexture(const std::string& name, const std::string& filePath) {
+    sf::Texture texture;
+    
+    std::vector<std::string> possiblePaths = candidatePaths(filePath);
     
     for (const auto& path : possiblePaths) {
         if (texture.loadFromFile(path)) {
@@ -102,7 +115,7 @@ bool ResourceManager::loadTexture(const std::string& name, const std::string& fi
     }
     
     std::cerr << "Failed to load texture: " << name << " (tried " << possiblePaths.size() << " paths)" << std::endl;
-    std::cerr << "Project root detected as: " << projectRoot << std::endl;
+    std::cerr << "Project root detected as: " << findProjectRoot() << std::endl;
     return false;
 }
 
@@ -118,6 +131,13 @@ const sf::Texture& ResourceManager::getTexture(const std::string& name) const {
     return it->second;
 }
 
+void ResourceManager::accountMemory(MemoryReport& report) const {
+    for (const auto& [name, texture] : m_textures) {
+        const sf::Vector2u size = texture.getSize();
+        report.set(name, MemoryReport::Kind::Gpu, static_cast<size_t>(size.x) * size.y * 4);
+    }
+}
+
 void ResourceManager::loadAllGameTextures() {
     std::cout << "Loading game textures..." << std::endl;
     
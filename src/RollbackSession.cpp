@@ -0,0 +1,314 @@
+#include "RollbackSession.hpp"
+#include "BinaryStream.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    constexpr uint32_t PacketMagic = 0x504e4453;    // "SDNP"
+    constexpr uint32_t ProtocolVersion = 2;         // Bump with any packet or gameplay change
+    
+    enum class PacketType : uint8_t {
+        Join,       // Guest -> host until the game starts
+        Start,      // Host -> guest: seed and settings
+        Inputs      // Both ways, every tick
+    };
+    
+    void writeHeader(BinaryWriter& writer, PacketType type) {
+        writer.write(PacketMagic);
+        writer.write(ProtocolVersion);
+        writer.write(Simulation::SaveVersion);
+        writer.write(type);
+    }
+}
+
+RollbackSession::RollbackSession(Simulation& simulation, NetTransport& transport, Role role)
+    : m_simulation(simulation), m_transport(transport), m_role(role),
+      m_localSlot(role == Role::Host ? 0 : 1), m_remoteSlot(role == Role::Host ? 1 : 0) {}
+
+void RollbackSession::host(uint32_t seed, const RuntimeSettings& settings) {
+    m_seed = seed;
+    m_settings = settings;
+}
+
+uint8_t RollbackSession::packInput(const PlayerInput& input) noexcept {
+    // Two bits per axis (none, negative, positive) and one for fire
+    const auto axis = [](float value) -> uint8_t { return value < -0.5f ? 1 : value > 0.5f ? 2 : 0; };
+    return static_cast<uint8_t>(axis(input.move.x) | axis(input.move.y) << 2 | (input.fire ? 1 : 0) << 4);
+}
+
+PlayerInput RollbackSession::unpackInput(uint8_t bits) noexcept {
+    const auto axis = [](uint8_t value) { return value == 1 ? -1.0f : value == 2 ? 1.0f : 0.0f; };
+    PlayerInput input;
+    input.move = sf::Vector2f(axis(bits & 3), axis((bits >> 2) & 3));
+    input.fire = (bits & 16) != 0;
+    return input;
+}
+
+RollbackSession::FrameStats RollbackSession::advance(const PlayerInput& localInput) {
+    FrameStats stats;
+    m_transport.update();
+    receivePackets();
+    
+    if (!m_connected) {
+        handshake();
+        m_lastFrame = stats;
+        return stats;
+    }
+    if (!m_peerLost && Clock::now() - m_lastHeard > std::chrono::duration<float>(Config::NetplayTimeout)) {
+        std::cout << "Netplay peer stopped responding" << std::endl;
+        m_peerLost = true;
+    }
+    if (m_peerLost) return stats;
+    
+    rollback(stats);
+    
+    // Nothing left to simulate; keep sending until the peer has our inputs up to the end
+    if (m_simulation.isGameOver()) {
+        if (!m_gameOverConfirmed && m_remoteConfirmed >= m_tick) {
+            m_gameOverConfirmed = true;
+            m_gameOverAt = Clock::now();
+        }
+        sendInputs();
+        m_lastFrame = stats;
+        return stats;
+    }
+    
+    const int32_t lead = static_cast<int32_t>(m_tick) - static_cast<int32_t>(m_remoteConfirmed);
+    if (lead >= static_cast<int32_t>(Config::NetplayMaxRollback)) {
+        stats.stalled = true;
+        ++m_totals.stalls;
+    } else if (!m_waitedLastTick && lead > m_peerLead + 1) {
+        // Both leads include the link latency, so their difference is how far our clock runs ahead
+        stats.waited = true;
+        ++m_totals.waits;
+    }
+    m_waitedLastTick = stats.waited;
+    
+    if (!stats.stalled && !stats.waited) {
+        m_localInputs[m_tick % History] = packInput(localInput);
+        if (m_tick >= m_remoteConfirmed) {
+            saveState(m_tick);
+        }
+        simulateTick(m_tick);
+        ++m_tick;
+        ++m_totals.ticks;
+    }
+    
+    sendInputs();
+    m_lastFrame = stats;
+    return stats;
+}
+
+void RollbackSession::receivePackets() {
+    NetTransport::Sender sender;
+    while (m_transport.receive(m_packet, sender)) {
+        BinaryReader reader(m_packet.data(), m_packet.size());
+        uint32_t magic = 0;
+        uint32_t protocol = 0;
+        uint32_t saveVersion = 0;
+        PacketType type{};
+        if (!reader.read(magic) || !reader.read(protocol) || !reader.read(saveVersion) || !reader.read(type) ||
+            magic != PacketMagic || protocol != ProtocolVersion || saveVersion != Simulation::SaveVersion) {
+            continue;
+        }
+        
+        // Only a well-formed Join makes a sender the host's peer, so stray datagrams can't lock the guest out
+        if (!m_transport.isPeer(sender)) {
+            if (type == PacketType::Join && m_role == Role::Host && !m_transport.hasPeer()) {
+                m_transport.setPeer(sender.address, sender.port);
+                std::cout << "Netplay peer is " << sender.address.toString() << ":" << sender.port << std::endl;
+            }
+            continue;
+        }
+        
+        if (type == PacketType::Start && m_role == Role::Guest && !m_connected) {
+            // The settings size every pool and budget, so a bad packet must not reach applySettings()
+            uint32_t seed = 0;
+            RuntimeSettings settings;
+            if (!reader.read(seed) || !settings.load(reader)) continue;
+            if (!RuntimeConfig::validate(settings)) {
+                std::cerr << "Ignoring a netplay Start packet with invalid settings" << std::endl;
+                continue;
+            }
+            m_seed = seed;
+            m_settings = settings;
+            beginGame();
+        } else if (type == PacketType::Inputs) {
+            handleInputs(reader);
+        }
+    }
+}
+
+void RollbackSession::handleInputs(BinaryReader& reader) {
+    uint32_t seed = 0;
+    uint32_t ack = 0;
+    int32_t lead = 0;
+    uint32_t first = 0;
+    uint8_t count = 0;
+    if (!reader.read(seed) || !reader.read(ack) || !reader.read(lead) || !reader.read(first) ||
+        !reader.read(count) || reader.remaining() < count || seed != m_seed) {
+        return;
+    }
+    
+    // The guest's first inputs answer the host's Start
+    if (!m_connected) {
+        if (m_role == Role::Guest) return;
+        beginGame();
+    }
+    
+    m_lastHeard = Clock::now();
+    m_peerAcked = std::max(m_peerAcked, std::min(ack, m_tick));
+    m_peerLead = lead;
+    
+    // Take the inputs that continue the confirmed run; a gap waits for a resend
+    for (uint32_t tick = first; tick < first + count; ++tick) {
+        uint8_t input = 0;
+        reader.read(input);
+        if (tick != m_remoteConfirmed) continue;
+        
+        m_remoteInputs[tick % History] = input;
+        if (tick < m_tick && m_usedRemoteInputs[tick % History] != input) {
+            m_rollbackFrom = std::min(m_rollbackFrom, tick);
+        }
+        ++m_remoteConfirmed;
+    }
+}
+
+void RollbackSession::handshake() {
+    const Clock::time_point now = Clock::now();
+    if (now - m_lastHandshake < std::chrono::duration<float>(Config::NetplayResendInterval)) return;
+    m_lastHandshake = now;
+    
+    m_packet.clear();
+    BinaryWriter writer(m_packet);
+    if (m_role == Role::Host) {
+        // The guest's Join told the transport where to send
+        if (!m_transport.hasPeer()) return;
+        writeHeader(writer, PacketType::Start);
+        writer.write(m_seed);
+        m_settings.save(writer);
+    } else {
+        writeHeader(writer, PacketType::Join);
+    }
+    m_transport.send(m_packet.data(), m_packet.size());
+}
+
+void RollbackSession::beginGame() {
+    m_connected = true;
+    m_lastHeard = Clock::now();
+    
+    m_simulation.applySettings(m_settings);
+    m_simulation.startNewGame(m_seed, 2);
+    const unsigned int tickRate = m_settings.targetFPS > 0 ? m_settings.targetFPS : Config::TargetFPS;
+    m_deltaTime = 1.0f / static_cast<float>(tickRate);
+    
+    std::cout << "Co-op game started (seed " << m_seed << "), you are player " << m_localSlot + 1 << std::endl;
+}
+
+void RollbackSession::rollback(FrameStats& stats) {
+    const uint32_t from = m_rollbackFrom;
+    m_rollbackFrom = UINT32_MAX;
+    if (from >= m_tick) return;
+    
+    const Clock::time_point start = Clock::now();
+    const std::vector<std::byte>& state = m_states[from % StateSlots];
+    m_simulation.load(state.data(), state.size());
+    for (uint32_t tick = from; tick < m_tick; ++tick) {
+        if (tick != from && tick >= m_remoteConfirmed) {
+            saveState(tick);
+        }
+        simulateTick(tick);
+    }
+    
+    stats.rollbackDepth = m_tick - from;
+    stats.resimulationSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    ++m_totals.rollbacks;
+    m_totals.resimulatedTicks += stats.rollbackDepth;
+    m_totals.maxDepth = std::max(m_totals.maxDepth, stats.rollbackDepth);
+    m_totals.resimulationSeconds += stats.resimulationSeconds;
+    m_totals.maxResimulationSeconds = std::max(m_totals.maxResimulationSeconds, stats.resimulationSeconds);
+    ++m_totals.depthCounts[std::min<size_t>(stats.rollbackDepth, m_totals.depthCounts.size() - 1)];
+}
+
+void RollbackSession::saveState(uint32_t tick) {
+    std::vector<std::byte>& state = m_states[tick % StateSlots];
+    state.clear();
+    m_simulation.save(state);
+}
+
+void RollbackSession::simulateTick(uint32_t tick) {
+    // Unconfirmed ticks assume the peer still holds its last known input
+    uint8_t remote = 0;
+    if (tick < m_remoteConfirmed) {
+        remote = m_remoteInputs[tick % History];
+    } else if (m_remoteConfirmed > 0) {
+        remote = m_remoteInputs[(m_remoteConfirmed - 1) % History];
+    }
+    m_usedRemoteInputs[tick % History] = remote;
+    
+    Simulation::PlayerInputs inputs{};
+    inputs[m_localSlot] = unpackInput(m_localInputs[tick % History]);
+    inputs[m_remoteSlot] = unpackInput(remote);
+    m_simulation.step(inputs, m_deltaTime);
+}
+
+void RollbackSession::sendInputs() {
+    // Everything the peer hasn't acknowledged, as far back as the history reaches
+    const uint32_t oldest = m_tick > History - 1 ? m_tick - (History - 1) : 0;
+    const uint32_t first = std::max(m_peerAcked, oldest);
+    
+    m_packet.clear();
+    BinaryWriter writer(m_packet);
+    writeHeader(writer, PacketType::Inputs);
+    writer.write(m_seed);
+    writer.write(m_remoteConfirmed);
+    writer.write(static_cast<int32_t>(m_tick) - static_cast<int32_t>(m_remoteConfirmed));
+    writer.write(first);
+    writer.write(static_cast<uint8_t>(m_tick - first));
+    for (uint32_t tick = first; tick < m_tick; ++tick) {
+        writer.write(m_localInputs[tick % History]);
+    }
+    m_transport.send(m_packet.data(), m_packet.size());
+}
+
+bool RollbackSession::isFinished() const noexcept {
+    if (m_peerLost) return true;
+    if (!m_gameOverConfirmed) return false;
+    
+    // Give up waiting for the final acknowledgement after a second; the peer has timeouts too
+    return m_peerAcked >= m_tick || Clock::now() - m_gameOverAt > std::chrono::seconds(1);
+}
+
+void RollbackSession::capture(RenderSnapshot& snapshot) const {
+    snapshot.netplay.active = true;
+    snapshot.netplay.connected = m_connected;
+    snapshot.netplay.localSlot = m_localSlot;
+    snapshot.netplay.rollbackDepth = m_lastFrame.rollbackDepth;
+    snapshot.netplay.resimulationMs = static_cast<float>(m_lastFrame.resimulationSeconds * 1000.0);
+    snapshot.netplay.maxRollbackDepth = m_totals.maxDepth;
+    snapshot.netplay.stalls = m_totals.stalls;
+    snapshot.gameOver = isFinished();
+}
+
+void RollbackSession::printSummary() const {
+    if (!m_connected) return;
+    
+    const Totals& totals = m_totals;
+    const double ticks = static_cast<double>(std::max<uint64_t>(totals.ticks, 1));
+    const double rollbacks = static_cast<double>(std::max<uint64_t>(totals.rollbacks, 1));
+    std::cout << "Co-op: " << totals.ticks << " ticks, " << totals.rollbacks << " rollbacks ("
+              << 100.0 * static_cast<double>(totals.rollbacks) / ticks << "% of ticks), "
+              << totals.stalls << " stalls, " << totals.waits << " sync waits" << std::endl;
+    std::cout << "Rollback depth: mean " << static_cast<double>(totals.resimulatedTicks) / rollbacks
+              << ", max " << totals.maxDepth << " ticks; resimulation cost: mean "
+              << totals.resimulationSeconds * 1e6 / rollbacks << " us, max "
+              << totals.maxResimulationSeconds * 1e6 << " us per rollback" << std::endl;
+    
+    std::cout << "Rollbacks by depth:";
+    for (size_t depth = 1; depth < totals.depthCounts.size(); ++depth) {
+        std::cout << " " << depth << ":" << totals.depthCounts[depth];
+    }
+    const NetTransport::Statistics& link = m_transport.getStats();
+    std::cout << "\nPackets: " << link.sent << " sent, " << link.dropped << " dropped by the shim, "
+              << link.received << " received" << std::endl;
+}
\ No newline at end of file
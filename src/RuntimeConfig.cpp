@@ -0,0 +1,284 @@
+#include "RuntimeConfig.hpp"
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+
+namespace {
+    std::string trim(const std::string& text) {
+        const auto first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return "";
+        const auto last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    template<typename T>
+    bool parseNumber(const std::string& text, T& out) {
+        const char* begin = text.data();
+        const char* end = text.data() + text.size();
+        if (text.empty()) return false;
+        
+        if constexpr (std::is_floating_point_v<T>) {
+            // strtof rather than from_chars: Apple's libc++ lacks floating-point from_chars
+            char* parsedEnd = nullptr;
+            const float value = std::strtof(begin, &parsedEnd);
+            if (parsedEnd != end) return false;
+            out = static_cast<T>(value);
+            return true;
+        } else {
+            auto [ptr, ec] = std::from_chars(begin, end, out);
+            return ec == std::errc() && ptr == end;
+        }
+    }
+}
+
+void RuntimeSettings::save(BinaryWriter& writer) const {
+    writer.write(static_cast<uint32_t>(targetFPS));
+    writer.write(maxDeltaTime);
+    writer.write(static_cast<uint64_t>(maxEnemies));
+    writer.write(enemySpawnCooldown);
+    writer.write(static_cast<uint64_t>(maxBullets));
+    writer.write(playerShootCooldown);
+    writer.write(static_cast<uint64_t>(maxParticles));
+    writer.write(particleLifetime);
+    writer.write(static_cast<uint64_t>(bulletPoolSize));
+    writer.write(static_cast<uint64_t>(enemyPoolSize));
+    writer.write(static_cast<uint8_t>(broadphase));
+    writer.write(static_cast<uint8_t>(particlePolicy));
+}
+
+bool RuntimeSettings::load(BinaryReader& reader) {
+    uint32_t fps = 0;
+    uint64_t enemies = 0;
+    uint64_t bullets = 0;
+    uint64_t particles = 0;
+    uint64_t bulletPool = 0;
+    uint64_t enemyPool = 0;
+    uint8_t broadphaseMode = 0;
+    uint8_t policy = 0;
+    RuntimeSettings loaded;
+    if (!(reader.read(fps) && reader.read(loaded.maxDeltaTime) && reader.read(enemies) &&
+          reader.read(loaded.enemySpawnCooldown) && reader.read(bullets) && reader.read(loaded.playerShootCooldown) &&
+          reader.read(particles) && reader.read(loaded.particleLifetime) && reader.read(bulletPool) &&
+          reader.read(enemyPool) && reader.read(broadphaseMode) && reader.read(policy))) {
+        return false;
+    }
+    
+    // Counts past size_t are clamped so validate() still sees them as too large
+    const auto count = [](uint64_t value) { return static_cast<size_t>(std::min<uint64_t>(value, SIZE_MAX)); };
+    loaded.targetFPS = fps;
+    loaded.maxEnemies = count(enemies);
+    loaded.maxBullets = count(bullets);
+    loaded.maxParticles = count(particles);
+    loaded.bulletPoolSize = count(bulletPool);
+    loaded.enemyPoolSize = count(enemyPool);
+    loaded.broadphase = static_cast<BroadphaseMode>(broadphaseMode);
+    loaded.particlePolicy = static_cast<ParticlePolicy>(policy);
+    *this = loaded;
+    return true;
+}
+
+bool RuntimeConfig::load(const std::string& path, const std::string& profile) {
+    m_path = path;
+    m_requestedProfile = profile;
+
+    std::error_code ec;
+    m_lastWriteTime = std::filesystem::last_write_time(m_path, ec);
+    if (ec) {
+        std::cout << "Runtime config not found at " << m_path << ", using built-in defaults" << std::endl;
+        return false;
+    }
+
+    RuntimeSettings settings;
+    std::string activeProfile;
+    if (!parseFile(settings, activeProfile)) {
+        return false;
+    }
+
+    m_settings = settings;
+    m_activeProfile = activeProfile;
+    m_loaded = true;
+    std::cout << "Runtime config loaded: profile '" << m_activeProfile << "' from " << m_path << std::endl;
+    return true;
+}
+
+bool RuntimeConfig::reloadIfChanged() {
+    if (m_path.empty()) return false;
+
+    std::error_code ec;
+    const auto writeTime = std::filesystem::last_write_time(m_path, ec);
+    if (ec || writeTime == m_lastWriteTime) return false;
+
+    m_lastWriteTime = writeTime;
+
+    // Keep the current settings if the edited file is broken
+    RuntimeSettings settings;
+    std::string activeProfile;
+    if (!parseFile(settings, activeProfile)) {
+        std::cerr << "Runtime config reload failed, keeping profile '" << m_activeProfile << "'" << std::endl;
+        return false;
+    }
+
+    m_settings = settings;
+    m_activeProfile = activeProfile;
+    m_loaded = true;
+    std::cout << "Runtime config reloaded: profile '" << m_activeProfile << "'" << std::endl;
+    return true;
+}
+
+bool RuntimeConfig::parseFile(RuntimeSettings& settings, std::string& activeProfile) const {
+    std::ifstream file(m_path);
+    if (!file) {
+        std::cerr << "Failed to open runtime config: " << m_path << std::endl;
+        return false;
+    }
+
+    // First pass: pick the profile (the command line wins over the file)
+    activeProfile = m_requestedProfile;
+    std::string line;
+    if (activeProfile.empty()) {
+        while (std::getline(file, line)) {
+            line = trim(line.substr(0, line.find_first_of("#;")));
+            if (line.empty()) continue;
+            if (line.front() == '[') break;
+
+            const auto equals = line.find('=');
+            if (equals != std::string::npos && trim(line.substr(0, equals)) == "profile") {
+                activeProfile = trim(line.substr(equals + 1));
+            }
+        }
+        if (activeProfile.empty()) {
+            activeProfile = Config::DefaultProfile;
+        }
+        file.clear();
+        file.seekg(0);
+    }
+
+    // Second pass: apply the selected section on top of the compiled defaults
+    settings = RuntimeSettings{};
+    std::string section;
+    bool profileFound = false;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        line = trim(line.substr(0, line.find_first_of("#;")));
+        if (line.empty()) continue;
+
+        if (line.front() == '[') {
+            const auto close = line.find(']');
+            section = trim(line.substr(1, close == std::string::npos ? std::string::npos : close - 1));
+            profileFound = profileFound || section == activeProfile;
+            continue;
+        }
+
+        if (section != activeProfile) continue;
+
+        const auto equals = line.find('=');
+        if (equals == std::string::npos) {
+            std::cerr << m_path << ":" << lineNumber << ": expected 'key = value'" << std::endl;
+            continue;
+        }
+
+        const std::string key = trim(line.substr(0, equals));
+        const std::string value = trim(line.substr(equals + 1));
+        if (!applyValue(settings, key, value)) {
+            std::cerr << m_path << ":" << lineNumber << ": ignoring invalid setting '" << key
+                      << " = " << value << "'" << std::endl;
+        }
+    }
+
+    if (!profileFound) {
+        std::cerr << "Runtime config profile '" << activeProfile << "' not found in " << m_path << std::endl;
+        return false;
+    }
+
+    if (!validate(settings)) {
+        std::cerr << "Runtime config profile '" << activeProfile << "' has values out of range" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool RuntimeConfig::applyValue(RuntimeSettings& settings, const std::string& key, const std::string& value) {
+    if (key == "TargetFPS") return parseNumber(value, settings.targetFPS);
+    if (key == "MaxDeltaTime") return parseNumber(value, settings.maxDeltaTime);
+    if (key == "MaxEnemies") return parseNumber(value, settings.maxEnemies);
+    if (key == "EnemySpawnCooldown") return parseNumber(value, settings.enemySpawnCooldown);
+    if (key == "MaxBullets") return parseNumber(value, settings.maxBullets);
+    if (key == "PlayerShootCooldown") return parseNumber(value, settings.playerShootCooldown);
+    if (key == "MaxParticles") return parseNumber(value, settings.maxParticles);
+    if (key == "ParticleLifetime") return parseNumber(value, settings.particleLifetime);
+    if (key == "BulletPoolSize") return parseNumber(value, settings.bulletPoolSize);
+    if (key == "EnemyPoolSize") return parseNumber(value, settings.enemyPoolSize);
+    if (key == "Broadphase") {
+        if (value == "brute") settings.broadphase = BroadphaseMode::BruteForce;
+        else if (value == "sweep") settings.broadphase = BroadphaseMode::SortAndSweep;
+        else return false;
+        return true;
+    }
+    if (key == "ParticlePolicy") {
+        if (value == "drop") settings.particlePolicy = ParticlePolicy::Drop;
+        else if (value == "evict") settings.particlePolicy = ParticlePolicy::EvictOldest;
+        else if (value == "grow") settings.particlePolicy = ParticlePolicy::Grow;
+        else return false;
+        return true;
+    }
+    return false;
+}
+
+bool RuntimeConfig::validate(RuntimeSettings& settings) {
+    bool valid = true;
+    const auto checkSeconds = [&valid](const char* key, float& value, float minimum) {
+        // std::max would pass NaN straight through
+        if (!std::isfinite(value) || value > Config::MaxSettingSeconds) {
+            std::cerr << "Runtime setting " << key << " = " << value << " is out of range (at most "
+                      << Config::MaxSettingSeconds << ")" << std::endl;
+            valid = false;
+            return;
+        }
+        value = std::max(value, minimum);
+    };
+    const auto checkCount = [&valid](const char* key, size_t& value, size_t minimum) {
+        if (value > Config::MaxEntityBudget) {
+            std::cerr << "Runtime setting " << key << " = " << value << " is out of range (at most "
+                      << Config::MaxEntityBudget << ")" << std::endl;
+            valid = false;
+            return;
+        }
+        value = std::max(value, minimum);
+    };
+
+    // TargetFPS of 0 disables the frame limiter, everything else must stay positive
+    if (settings.targetFPS > Config::MaxTargetFPS) {
+        std::cerr << "Runtime setting TargetFPS = " << settings.targetFPS << " is out of range (at most "
+                  << Config::MaxTargetFPS << ")" << std::endl;
+        valid = false;
+    }
+    checkSeconds("MaxDeltaTime", settings.maxDeltaTime, 0.001f);
+    checkSeconds("EnemySpawnCooldown", settings.enemySpawnCooldown, 0.0f);
+    checkSeconds("PlayerShootCooldown", settings.playerShootCooldown, 0.0f);
+    checkSeconds("ParticleLifetime", settings.particleLifetime, 0.01f);
+    checkCount("MaxEnemies", settings.maxEnemies, 0);
+    checkCount("MaxBullets", settings.maxBullets, 0);
+    checkCount("MaxParticles", settings.maxParticles, 0);
+    checkCount("BulletPoolSize", settings.bulletPoolSize, 1);
+    checkCount("EnemyPoolSize", settings.enemyPoolSize, 1);
+
+    // Profiles can only name known modes, but settings read from a save or a packet are raw bytes
+    if (settings.broadphase != BroadphaseMode::BruteForce && settings.broadphase != BroadphaseMode::SortAndSweep) {
+        std::cerr << "Runtime setting Broadphase = " << static_cast<int>(settings.broadphase)
+                  << " is not a known mode" << std::endl;
+        valid = false;
+    }
+    if (settings.particlePolicy > ParticlePolicy::Grow) {
+        std::cerr << "Runtime setting ParticlePolicy = " << static_cast<int>(settings.particlePolicy)
+                  << " is not a known policy" << std::endl;
+        valid = false;
+    }
+    return valid;
+}
\ No newline at end of file
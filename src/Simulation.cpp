@@ -0,0 +1,669 @@
+#include "Simulation.hpp"
+#include "BulletSystem.hpp"
+#include "ResourceManager.hpp"
+#include "Systems.hpp"
+#include "Config.hpp"
+#include "Utils.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+namespace {
+    constexpr uint32_t SaveMagic = 0x56534453;      // "SDSV"
+    
+    const sf::Texture* findTexture(const ResourceManager& resources, const std::string& name) {
+        return resources.hasTexture(name) ? &resources.getTexture(name) : nullptr;
+    }
+    
+    // Saved worlds name components by id, and ids are handed out on first use.
+    // Registering every component up front, in order, gives each run the same ids
+    template<typename... Cs>
+    void registerInOrder() {
+        (static_cast<void>(ComponentRegistry::id<Cs>()), ...);
+    }
+    
+    // Saved sprites and presence masks refer to textures by their slot in this table
+    using TextureTable = std::array<const sf::Texture*, 8>;
+    constexpr uint8_t NoTextureSlot = 0xFF;
+    
+    TextureTable textureTable(const SimulationAssets& assets) noexcept {
+        return {assets.player, assets.basicEnemy, assets.fastEnemy, assets.heavyEnemy,
+                assets.playerBullet, assets.enemyBullet, assets.heavyBullet, assets.explosion};
+    }
+    
+    // Saved sprites hold their texture's slot where the pointer was
+    static_assert(std::is_standard_layout_v<SpriteVisual>, "offsetof needs a standard-layout SpriteVisual");
+    constexpr size_t SpriteTextureOffset = offsetof(SpriteVisual, texture);
+    
+    void encodeSpriteTexture(std::byte* element, const void* context) noexcept {
+        const TextureTable& textures = *static_cast<const TextureTable*>(context);
+        const sf::Texture* texture = nullptr;
+        std::memcpy(&texture, element + SpriteTextureOffset, sizeof(texture));
+        
+        const auto found = std::find(textures.begin(), textures.end(), texture);
+        const uintptr_t slot = texture && found != textures.end() ?
+            static_cast<uintptr_t>(found - textures.begin()) : NoTextureSlot;
+        static_assert(sizeof(slot) == sizeof(texture));
+        std::memcpy(element + SpriteTextureOffset, &slot, sizeof(slot));
+    }
+    
+    // Adds the time since the previous mark to a phase; free when profiling is off
+    class PhaseClock {
+    private:
+        using Clock = std::chrono::steady_clock;
+        Simulation::PhaseTimes* m_times;
+        Clock::time_point m_last;
+        
+    public:
+        explicit PhaseClock(Simulation::PhaseTimes* times) noexcept
+            : m_times(times), m_last(times ? Clock::now() : Clock::time_point{}) {}
+        
+        void mark(Simulation::Phase phase) noexcept {
+            if (!m_times) return;
+            const Clock::time_point now = Clock::now();
+            m_times->seconds[static_cast<size_t>(phase)] += std::chrono::duration<double>(now - m_last).count();
+            m_last = now;
+        }
+    };
+}
+
+SimulationAssets SimulationAssets::fromResources(const ResourceManager& resources) {
+    SimulationAssets assets;
+    assets.player = findTexture(resources, "player_ship");
+    assets.basicEnemy = findTexture(resources, "enemy_basic");
+    assets.fastEnemy = findTexture(resources, "enemy_fast");
+    assets.heavyEnemy = findTexture(resources, "enemy_heavy");
+    assets.playerBullet = findTexture(resources, "player_bullet");
+    assets.enemyBullet = findTexture(resources, "enemy_bullet");
+    assets.heavyBullet = findTexture(resources, "heavy_bullet");
+    assets.explosion = findTexture(resources, "explosion");
+    return assets;
+}
+
+uint32_t SimulationAssets::presenceMask() const noexcept {
+    uint32_t mask = 0;
+    const auto textures = textureTable(*this);
+    for (size_t slot = 0; slot < textures.size(); ++slot) {
+        mask |= textures[slot] ? 1u << slot : 0u;
+    }
+    return mask;
+}
+
+SimulationAssets SimulationAssets::placeholders(uint32_t mask) {
+    // Never drawn; sprites only need a texture to exist. One per slot, so a
+    // sprite's texture still says which slot it came from
+    static const std::array<sf::Texture, 8> placeholders;
+    const auto pick = [mask](uint32_t slot) { return (mask >> slot) & 1u ? &placeholders[slot] : nullptr; };
+    
+    SimulationAssets assets;
+    assets.player = pick(0);
+    assets.basicEnemy = pick(1);
+    assets.fastEnemy = pick(2);
+    assets.heavyEnemy = pick(3);
+    assets.playerBullet = pick(4);
+    assets.enemyBullet = pick(5);
+    assets.heavyBullet = pick(6);
+    assets.explosion = pick(7);
+    return assets;
+}
+
+Simulation::Simulation(uint32_t seed) : m_rng(seed) {
+    registerInOrder<Transform, Velocity, Health, Weapon, Collider, Bounds, PlayerControl, EnemyAI, Projectile,
+                    Explosion, Particle, SpriteVisual, ShapeVisual>();
+    applySettings(m_settings);
+}
+
+void Simulation::setAssets(const SimulationAssets& assets) {
+    m_assets = assets;
+    m_explosionSystem.initialize(assets.explosion);
+}
+
+void Simulation::applySettings(const RuntimeSettings& settings) {
+    m_settings = settings;
+    
+    // Storage only grows; lowered caps take effect as active entities die off
+    EnemySystem::reserve(m_world, settings.enemyPoolSize);
+    BulletSystem::reserve(m_world, settings.bulletPoolSize);
+    m_shooters.reserve(settings.maxEnemies);
+    m_broadphase.setMode(settings.broadphase);
+    
+    // Bullets, enemies, particles and players at their caps, plus an explosion per bullet.
+    // Per-tick scratch sized for that never grows mid-game
+    const size_t colliders = settings.maxBullets + settings.maxEnemies + Config::MaxPlayers;
+    m_entityBudget = colliders + settings.maxParticles + settings.maxBullets;
+    m_world.reserveEntities(m_entityBudget);
+    m_broadphase.reserve(colliders, m_entityBudget);
+    m_bulletHits.reserve(settings.maxBullets);
+    m_pendingEffects.reserve(settings.maxBullets + settings.maxEnemies);
+    m_explosionSystem.reserve(m_world, settings.maxBullets + settings.maxEnemies);
+    
+    m_particleSystem.setPolicy(settings.particlePolicy);
+    m_particleSystem.setCapacity(settings.maxParticles);
+    m_particleSystem.setLifetime(settings.particleLifetime);
+    m_particleSystem.reserve(m_world);
+    
+    for (const Entity player : m_players) {
+        if (Weapon* weapon = m_world.get<Weapon>(player)) {
+            weapon->cooldown = settings.playerShootCooldown;
+        }
+    }
+}
+
+void Simulation::startNewGame(uint32_t seed, size_t playerCount) {
+    clear();
+    resetProgress();
+    m_rng.seed(seed);
+    
+    // A lone ship starts in the centre, co-op ships either side of it
+    m_playerCount = static_cast<uint32_t>(std::clamp<size_t>(playerCount, 1, Config::MaxPlayers));
+    for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+        float offset = 0.0f;
+        if (m_playerCount > 1) {
+            offset = slot == 0 ? -Config::CoopSpawnOffset : Config::CoopSpawnOffset;
+        }
+        m_players[slot] = PlayerSystem::spawn(m_world,
+                                              sf::Vector2f(Config::WindowWidth / 2 + offset, Config::WindowHeight / 2),
+                                              m_settings.playerShootCooldown, m_assets.player, slot);
+    }
+    
+    // Spawn initial enemies
+    for (size_t i = 0; i < 2; ++i) {
+        spawnEnemy();
+    }
+}
+
+void Simulation::resetProgress() {
+    m_tick = 0;
+    m_playerCount = 1;
+    m_gameOver = false;
+    m_score = 0;
+    m_enemiesKilled = 0;
+    m_killsByType = {};
+    m_enemySpawnTimer = 0.0f;
+    m_sounds = {};
+}
+
+void Simulation::clear() {
+    m_world.clear();
+    m_players = {};
+    m_pendingEffects.clear();
+    m_particleSystem.clear();
+}
+
+void Simulation::step(const PlayerInputs& inputs, float deltaTime) {
+    if (m_gameOver) return;
+    ++m_tick;
+    PhaseClock clock(m_profiling ? &m_phaseTimes : nullptr);
+    
+    // Update players
+    for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+        if (!isPlayerAlive(slot)) continue;
+        PlayerSystem::update(m_world, m_players[slot], inputs[slot], deltaTime);
+        if (inputs[slot].fire) {
+            shootBullet(m_players[slot]);
+        }
+    }
+    clock.mark(Phase::Player);
+    
+    // Everything with a Velocity moves
+    Systems::integrateMotion(m_world, deltaTime);
+    clock.mark(Phase::Motion);
+    
+    // Batch enemy AI: bounce, re-steer, face the player and collect enemies ready to fire
+    m_shooters.clear();
+    size_t targetCount = 0;
+    for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+        if (isPlayerAlive(slot)) {
+            m_targets[targetCount++] = m_world.get<Transform>(m_players[slot])->position;
+        }
+    }
+    EnemySystem::update(m_world, m_enemyBatch, m_rng, m_targets.data(), targetCount, deltaTime, m_shooters);
+    for (const Entity enemy : m_shooters) {
+        const sf::Vector2f& position = m_world.get<Transform>(enemy)->position;
+        enemyShoot(enemy, EnemySystem::nearestTarget(position, m_targets.data(), targetCount));
+    }
+    clock.mark(Phase::EnemyAI);
+    
+    BulletSystem::cullOffscreen(m_world);
+    
+    // Update particles and explosions
+    m_particleSystem.update(m_world, deltaTime);
+    m_explosionSystem.update(m_world, deltaTime);
+    clock.mark(Phase::Effects);
+    
+    // Hit tests below read cached boxes; only entities that moved are rebuilt
+    m_boundsRebuilt = Systems::updateBounds(m_world);
+    clock.mark(Phase::Bounds);
+    
+    checkCollisions();
+    clock.mark(Phase::Collisions);
+    
+    // Player deaths are resolved here so the killing hit's effects play first
+    bool anyAlive = false;
+    for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+        const Entity player = m_players[slot];
+        if (const Health* health = m_world.get<Health>(player); health && health->current <= 0.0f) {
+            const sf::Vector2f position = m_world.get<Transform>(player)->position;
+            m_explosionSystem.createExplosion(m_world, position, ExplosionType::Large);
+            m_particleSystem.emit(m_world, position, sf::Color::Cyan, 30);
+            ++m_sounds.explosions;
+            m_world.destroyLater(player);
+        } else {
+            anyAlive = anyAlive || health;
+        }
+    }
+    m_gameOver = !anyAlive;
+    
+    // Remove dead entities and finished effects
+    cleanupDeadObjects();
+    clock.mark(Phase::Cleanup);
+    
+    // Spawn enemies
+    m_enemySpawnTimer += deltaTime;
+    if (m_enemySpawnTimer > m_settings.enemySpawnCooldown &&
+        m_world.count<EnemyAI>() < m_settings.maxEnemies) {
+        spawnEnemy();
+        m_enemySpawnTimer = 0.0f;
+    }
+    clock.mark(Phase::Spawning);
+    if (m_profiling) {
+        ++m_phaseTimes.ticks;
+    }
+}
+
+void Simulation::capture(RenderSnapshot& snapshot) const {
+    snapshot.reserve(m_entityBudget);
+    Systems::capture(m_world, snapshot, Config::ShowDebugBoundaries);
+    
+    snapshot.tick = m_tick;
+    snapshot.score = m_score;
+    snapshot.enemiesKilled = m_enemiesKilled;
+    snapshot.playerCount = m_playerCount;
+    for (uint32_t slot = 0; slot < Config::MaxPlayers; ++slot) {
+        const Health* health = slot < m_playerCount ? m_world.get<Health>(m_players[slot]) : nullptr;
+        snapshot.playerAlive[slot] = health != nullptr;
+        snapshot.playerHealth[slot] = health ? health->ratio() : 0.0f;
+    }
+    snapshot.gameOver = m_gameOver;
+    snapshot.sounds = m_sounds;
+    
+    snapshot.enemies = m_world.count<EnemyAI>();
+    snapshot.bullets = m_world.count<Projectile>();
+    snapshot.particles = m_particleSystem.getActiveCount();
+    snapshot.particleCapacity = m_particleSystem.getCapacity();
+    snapshot.particleEvictions = m_particleSystem.getEvictions();
+    snapshot.boundsRebuilt = m_boundsRebuilt;
+    snapshot.world = m_world.getStats();
+    snapshot.broadphase = m_broadphase.getStats();
+    snapshot.broadphaseMode = m_broadphase.getMode();
+    accountMemory(snapshot.memory);
+}
+
+void Simulation::accountMemory(MemoryReport& report) const {
+    using Kind = MemoryReport::Kind;
+    report.set("Players", Kind::Cpu, m_world.archetypeBytes<PlayerControl>());
+    report.set("Enemies", Kind::Cpu, m_world.archetypeBytes<EnemyAI>());
+    report.set("Bullets", Kind::Cpu, m_world.archetypeBytes<Projectile>());
+    report.set("Particles", Kind::Cpu, m_world.archetypeBytes<Particle>() + m_particleSystem.scratchBytes());
+    report.set("Explosions", Kind::Cpu, m_world.archetypeBytes<Explosion>());
+    report.set("Entity table", Kind::Cpu, m_world.tableBytes());
+    report.set("Broadphase", Kind::Cpu, m_broadphase.memoryBytes());
+    report.set("Enemy AI scratch", Kind::Cpu, m_enemyBatch.memoryBytes() + MemoryReport::capacityBytes(m_shooters));
+    report.set("Collision scratch", Kind::Cpu, MemoryReport::capacityBytes(m_bulletHits, m_pendingEffects));
+}
+
+void Simulation::save(std::vector<std::byte>& buffer) const {
+    static_assert(std::is_trivially_copyable_v<std::mt19937>, "RNG state is saved as raw bytes");
+    BinaryWriter writer(buffer);
+    
+    writer.write(SaveMagic);
+    writer.write(SaveVersion);
+    m_settings.save(writer);
+    
+    // The slots that had a texture, so a load into a simulation missing one drops those sprites' textures
+    const TextureTable textures = textureTable(m_assets);
+    for (size_t slot = 0; slot < textures.size(); ++slot) {
+        writer.write(textures[slot] ? static_cast<uint8_t>(slot) : NoTextureSlot);
+    }
+    
+    writer.write(m_tick);
+    writer.write(m_gameOver);
+    writer.write(m_playerCount);
+    writer.write(m_players);
+    writer.write(m_enemySpawnTimer);
+    writer.write(m_score);
+    writer.write(m_enemiesKilled);
+    writer.write(m_killsByType);
+    writer.write(m_sounds);
+    writer.write(m_boundsRebuilt);
+    writer.write(m_rng);
+    m_particleSystem.save(writer);
+    writer.writeVector(m_pendingEffects);
+    
+    // The broadphase's kept sort order and the AI batch are caches; hits are
+    // resolved in a fixed order whatever order the pairs come in
+    m_world.save(writer, {ComponentRegistry::id<SpriteVisual>(), encodeSpriteTexture, &textures});
+}
+
+bool Simulation::load(const std::byte* data, size_t size) {
+    BinaryReader reader(data, size);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!reader.read(magic) || magic != SaveMagic || !reader.read(version) || version != SaveVersion) {
+        std::cerr << "Saved state is not a version " << SaveVersion << " simulation" << std::endl;
+        clear();
+        resetProgress();
+        return false;
+    }
+    
+    // Everything lands in locals first, so a rejected buffer can't leave a member out of range
+    RuntimeSettings settings;
+    std::array<uint8_t, 8> savedSlots{};
+    uint64_t tick = 0;
+    bool gameOver = false;
+    uint32_t playerCount = 0;
+    std::array<Entity, Config::MaxPlayers> players{};
+    float enemySpawnTimer = 0.0f;
+    int score = 0;
+    int enemiesKilled = 0;
+    std::array<int, EnemyTypeCount> killsByType{};
+    SoundCounters sounds;
+    size_t boundsRebuilt = 0;
+    std::mt19937 rng;
+    bool ok = settings.load(reader) && RuntimeConfig::validate(settings);
+    for (uint8_t& slot : savedSlots) {
+        ok = ok && reader.read(slot);
+    }
+    ok = ok && reader.read(tick) && reader.read(gameOver) && reader.read(playerCount) &&
+         playerCount >= 1 && playerCount <= Config::MaxPlayers && reader.read(players) &&
+         reader.read(enemySpawnTimer) && reader.read(score) && reader.read(enemiesKilled) &&
+         reader.read(killsByType) && reader.read(sounds) && reader.read(boundsRebuilt) && reader.read(rng) &&
+         m_particleSystem.load(reader) && reader.readVector(m_pendingEffects) && m_world.load(reader);
+    
+    // The world only checks its own structure; enums used as indices or in switches are checked here
+    for (const ImpactEffect& effect : m_pendingEffects) {
+        ok = ok && effect.particleCount >= 0 && effect.explosion <= ExplosionType::Large;
+    }
+    if (ok) {
+        m_world.each<EnemyAI>([&](const EnemyAI& ai) {
+            ok = ok && static_cast<size_t>(ai.type) < EnemyTypeCount;
+        });
+    }
+    
+    if (!ok) {
+        std::cerr << "Saved simulation state is truncated or malformed" << std::endl;
+        clear();
+        resetProgress();
+        return false;
+    }
+    
+    m_tick = tick;
+    m_gameOver = gameOver;
+    m_playerCount = playerCount;
+    m_players = players;
+    m_enemySpawnTimer = enemySpawnTimer;
+    m_score = score;
+    m_enemiesKilled = enemiesKilled;
+    m_killsByType = killsByType;
+    m_sounds = sounds;
+    m_boundsRebuilt = boundsRebuilt;
+    m_rng = rng;
+    applySettings(settings);
+    
+    // Point sprites at this simulation's texture for their saved slot
+    const TextureTable textures = textureTable(m_assets);
+    m_world.each<SpriteVisual>([&](SpriteVisual& visual) {
+        uintptr_t slot = NoTextureSlot;
+        std::memcpy(&slot, &visual.texture, sizeof(slot));
+        visual.texture = slot < textures.size() && savedSlots[slot] == slot ? textures[slot] : nullptr;
+    });
+    return true;
+}
+
+void Simulation::setProfiling(bool enabled) noexcept {
+    if (enabled && !m_profiling) {
+        m_phaseTimes = {};
+    }
+    m_profiling = enabled;
+}
+
+const char* Simulation::phaseName(Phase phase) noexcept {
+    switch (phase) {
+        case Phase::Player: return "Player";
+        case Phase::Motion: return "Motion";
+        case Phase::EnemyAI: return "EnemyAI";
+        case Phase::Effects: return "Effects";
+        case Phase::Bounds: return "Bounds";
+        case Phase::Collisions: return "Collisions";
+        case Phase::Cleanup: return "Cleanup";
+        case Phase::Spawning: return "Spawning";
+        case Phase::Count: break;
+    }
+    return "Unknown";
+}
+
+std::unique_ptr<Simulation> Simulation::fork() const {
+    std::vector<std::byte> buffer;
+    save(buffer);
+    
+    auto copy = std::make_unique<Simulation>(0);
+    copy->setAssets(m_assets);
+    copy->load(buffer.data(), buffer.size());
+    return copy;
+}
+
+void Simulation::checkCollisions() {
+    // Layer bits for the broadphase; each side lists the layers it can hit
+    constexpr uint32_t PlayerLayer = 1u << 0;
+    constexpr uint32_t EnemyLayer = 1u << 1;
+    constexpr uint32_t PlayerShotLayer = 1u << 2;
+    constexpr uint32_t EnemyShotLayer = 1u << 3;
+    
+    m_broadphase.clear();
+    
+    // Bullets submit the box they swept this tick, from where the last pass saw
+    // them, so fast bullets and long ticks can't step over a target
+    m_world.each<Transform, Bounds, Projectile>(
+        [&](Entity bullet, const Transform& transform, const Bounds& bounds, const Projectile& projectile) {
+            const sf::Vector2f delta = transform.position - projectile.lastPosition;
+            const sf::FloatRect& end = bounds.collision;
+            const sf::Vector2f start = end.position - delta;
+            const sf::Vector2f low(std::min(start.x, end.position.x), std::min(start.y, end.position.y));
+            const sf::Vector2f high(std::max(start.x, end.position.x) + end.size.x,
+                                    std::max(start.y, end.position.y) + end.size.y);
+            
+            if (projectile.fromPlayer) {
+                m_broadphase.add(bullet, sf::FloatRect(low, high - low), PlayerShotLayer, EnemyLayer);
+            } else {
+                m_broadphase.add(bullet, sf::FloatRect(low, high - low), EnemyShotLayer, PlayerLayer);
+            }
+        });
+    m_world.each<Bounds, EnemyAI>([&](Entity enemy, const Bounds& bounds, const EnemyAI&) {
+        m_broadphase.add(enemy, bounds.collision, EnemyLayer, PlayerShotLayer);
+    });
+    for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+        if (isPlayerAlive(slot)) {
+            const Entity player = m_players[slot];
+            m_broadphase.add(player, m_world.get<Bounds>(player)->collision, PlayerLayer, EnemyShotLayer);
+        }
+    }
+    
+    // Exact swept test for each candidate pair
+    m_bulletHits.clear();
+    for (const CollisionPair& pair : m_broadphase.findPairs()) {
+        const bool firstIsBullet = m_world.has<Projectile>(pair.first);
+        const Entity bullet = firstIsBullet ? pair.first : pair.second;
+        const Entity target = firstIsBullet ? pair.second : pair.first;
+        
+        const Projectile& projectile = *m_world.get<Projectile>(bullet);
+        const sf::Vector2f delta = m_world.get<Transform>(bullet)->position - projectile.lastPosition;
+        float time;
+        if (Utils::sweepRect(m_world.get<Bounds>(bullet)->collision, delta,
+                             m_world.get<Bounds>(target)->collision, time)) {
+            m_bulletHits.push_back({time, bullet, target});
+        }
+    }
+    
+    // Earliest contacts first, so a bullet stops at the first target on its path
+    // and the result doesn't depend on the broadphase's pair order
+    std::sort(m_bulletHits.begin(), m_bulletHits.end(), [](const BulletHit& a, const BulletHit& b) {
+        if (a.time != b.time) return a.time < b.time;
+        if (a.bullet != b.bullet) return a.bullet.value() < b.bullet.value();
+        return a.target.value() < b.target.value();
+    });
+    
+    for (const BulletHit& hit : m_bulletHits) {
+        if (!m_world.isAlive(hit.bullet) || !m_world.isAlive(hit.target)) continue;
+        
+        const Projectile& projectile = *m_world.get<Projectile>(hit.bullet);
+        const sf::Vector2f position = m_world.get<Transform>(hit.bullet)->position;
+        const sf::Vector2f impact = position - (position - projectile.lastPosition) * (1.0f - hit.time);
+        Health& health = *m_world.get<Health>(hit.target);
+        
+        if (m_world.has<PlayerControl>(hit.target)) {
+            if (health.current <= 0.0f) continue;
+            health.applyDamage(projectile.damage);
+            m_world.destroyLater(hit.bullet);
+            
+            // Small explosion at bullet impact point
+            m_pendingEffects.push_back({impact, 5, sf::Color::Red, ExplosionType::Small});
+            ++m_sounds.hits;
+            continue;
+        }
+        
+        const EnemyAI& ai = *m_world.get<EnemyAI>(hit.target);
+        const bool killed = health.applyDamage(projectile.damage);
+        m_world.destroyLater(hit.bullet);
+        
+        // Small explosion at bullet impact point
+        m_pendingEffects.push_back({impact, 0, sf::Color::Transparent, ExplosionType::Small});
+        ++m_sounds.hits;
+        
+        if (killed) {
+            m_score += EnemySystem::getScoreValue(ai.type);
+            m_enemiesKilled++;
+            ++m_killsByType[static_cast<size_t>(ai.type)];
+            
+            // Create explosion based on enemy type
+            ExplosionType explosionType = ExplosionType::Medium;
+            switch (ai.type) {
+                case EnemyType::BasicEnemy:
+                    explosionType = ExplosionType::Medium;
+                    break;
+                case EnemyType::FastEnemy:
+                    explosionType = ExplosionType::Small;
+                    break;
+                case EnemyType::HeavyEnemy:
+                    explosionType = ExplosionType::Large;
+                    break;
+            }
+            
+            m_pendingEffects.push_back({m_world.get<Transform>(hit.target)->position, 20, ai.baseColor, explosionType});
+            ++m_sounds.explosions;
+            m_world.destroyLater(hit.target);
+        }
+    }
+    
+    // The next pass sweeps from here
+    m_world.each<Transform, Projectile>([](const Transform& transform, Projectile& projectile) {
+        projectile.lastPosition = transform.position;
+    });
+    
+    spawnPendingEffects();
+}
+
+void Simulation::spawnPendingEffects() {
+    for (const ImpactEffect& effect : m_pendingEffects) {
+        m_explosionSystem.createExplosion(m_world, effect.position, effect.explosion);
+        if (effect.particleCount > 0) {
+            m_particleSystem.emit(m_world, effect.position, effect.particleColor, effect.particleCount);
+        }
+    }
+    m_pendingEffects.clear();
+}
+
+void Simulation::cleanupDeadObjects() {
+    // Dead enemies, spent bullets, finished explosions and expired particles
+    m_world.flush();
+}
+
+void Simulation::spawnEnemy() {
+    if (m_world.count<EnemyAI>() >= m_settings.maxEnemies) return;
+    
+    // Find spawn position away from player
+    float x = m_unitDist(m_rng) * Config::WindowWidth;
+    float y = m_unitDist(m_rng) * Config::WindowHeight;
+    
+    constexpr float MinDistance = 150.0f;
+    constexpr float MinDistanceSquared = MinDistance * MinDistance;
+    const auto tooClose = [&](const sf::Vector2f& position) {
+        for (uint32_t slot = 0; slot < m_playerCount; ++slot) {
+            const Transform* playerTransform = m_world.get<Transform>(m_players[slot]);
+            if (playerTransform &&
+                Utils::distanceSquared(position, playerTransform->position) < MinDistanceSquared) {
+                return true;
+            }
+        }
+        return false;
+    };
+    
+    int attempts = 0;
+    while (tooClose(sf::Vector2f(x, y)) && attempts++ < 10) {
+        x = m_unitDist(m_rng) * Config::WindowWidth;
+        y = m_unitDist(m_rng) * Config::WindowHeight;
+    }
+    
+    // Choose enemy type
+    EnemyType type;
+    const float rand = m_unitDist(m_rng);
+    if (rand < 0.5f) {
+        type = EnemyType::BasicEnemy;
+    } else if (rand < 0.8f) {
+        type = EnemyType::FastEnemy;
+    } else {
+        type = EnemyType::HeavyEnemy;
+    }
+    
+    const sf::Texture* texture = nullptr;
+    switch (type) {
+        case EnemyType::BasicEnemy:
+            texture = m_assets.basicEnemy;
+            break;
+        case EnemyType::FastEnemy:
+            texture = m_assets.fastEnemy;
+            break;
+        case EnemyType::HeavyEnemy:
+            texture = m_assets.heavyEnemy;
+            break;
+    }
+    EnemySystem::spawn(m_world, sf::Vector2f(x, y), type, m_rng, texture);
+}
+
+void Simulation::shootBullet(Entity player) {
+    Weapon* weapon = m_world.get<Weapon>(player);
+    if (!weapon || !weapon->ready()) return;
+    if (m_world.count<Projectile>() >= m_settings.maxBullets) return;
+    
+    const Transform& transform = *m_world.get<Transform>(player);
+    BulletSystem::spawn(m_world, PlayerSystem::getShootPosition(m_world, player),
+                        PlayerSystem::getShootDirection(transform), true, m_assets.playerBullet);
+    weapon->fire();
+    ++m_sounds.shots;
+}
+
+void Simulation::enemyShoot(Entity enemy, const sf::Vector2f& target) {
+    const EnemyAI* ai = m_world.get<EnemyAI>(enemy);
+    if (!ai || m_world.count<Projectile>() >= m_settings.maxBullets) return;
+    
+    // Heavy enemies fire their own bullet sprite
+    const sf::Texture* texture = ai->type == EnemyType::HeavyEnemy ? m_assets.heavyBullet : m_assets.enemyBullet;
+    
+    BulletSystem::spawn(m_world, EnemySystem::getCenteredShootPosition(m_world, enemy, target),
+                        EnemySystem::getShootDirection(*m_world.get<Transform>(enemy), target), false, texture);
+    m_world.get<Weapon>(enemy)->fire();
+    ++m_sounds.shots;
+}
\ No newline at end of file
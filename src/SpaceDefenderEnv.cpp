@@ -0,0 +1,369 @@
+#include "SpaceDefenderEnv.h"
+#include "ResourceManager.hpp"
+#include "RuntimeConfig.hpp"
+#include "Simulation.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(sizeof(sd_observation) == SD_OBSERVATION_FLOATS * sizeof(float), "Observations must be all floats");
+static_assert(sizeof(sd_action) == 3 * sizeof(float), "Actions must be all floats");
+
+namespace {
+    /**
+     * @brief Threads that stay parked between batches and run one parallel loop at a time
+     *
+     * forEach() hands out indices from an atomic counter, works on them from
+     * the calling thread too, and returns once every index is done. Waking
+     * parked threads costs far less than starting new ones every tick.
+     */
+    class WorkerPool {
+    private:
+        using Job = std::function<void(size_t)>;
+        
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_finished;
+        const Job* m_job = nullptr;
+        size_t m_jobCount = 0;
+        std::atomic<size_t> m_next{0};
+        size_t m_busy = 0;                // Workers still in the current round
+        uint64_t m_round = 0;
+        bool m_stopping = false;
+        
+    public:
+        // threads counts the caller, so a pool of 1 starts no threads
+        explicit WorkerPool(unsigned int threads) {
+            for (unsigned int i = 1; i < threads; ++i) {
+                m_threads.emplace_back(&WorkerPool::work, this);
+            }
+        }
+        
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_wake.notify_all();
+            for (std::thread& thread : m_threads) {
+                thread.join();
+            }
+        }
+        
+        void forEach(size_t count, const Job& job) {
+            if (m_threads.empty() || count <= 1) {
+                for (size_t i = 0; i < count; ++i) {
+                    job(i);
+                }
+                return;
+            }
+            
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = &job;
+                m_jobCount = count;
+                m_next.store(0);
+                m_busy = m_threads.size();
+                ++m_round;
+            }
+            m_wake.notify_all();
+            drain(job, count);
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_finished.wait(lock, [this] { return m_busy == 0; });
+        }
+        
+    private:
+        void drain(const Job& job, size_t count) {
+            for (size_t i = m_next++; i < count; i = m_next++) {
+                job(i);
+            }
+        }
+        
+        void work() {
+            uint64_t seen = 0;
+            while (true) {
+                const Job* job = nullptr;
+                size_t count = 0;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [&] { return m_stopping || m_round != seen; });
+                    if (m_stopping) return;
+                    seen = m_round;
+                    job = m_job;
+                    count = m_jobCount;
+                }
+                
+                drain(*job, count);
+                
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_busy == 0) {
+                    m_finished.notify_one();
+                }
+            }
+        }
+    };
+    
+    // The N nearest of whatever is offered, kept sorted without allocating
+    template<size_t N>
+    struct Nearest {
+        std::array<float, N> distances{};
+        std::array<Entity, N> entities{};
+        size_t count = 0;
+        
+        void offer(float distance, Entity entity) noexcept {
+            if (count == N && distance >= distances[N - 1]) return;
+            size_t slot = count < N ? count++ : N - 1;
+            while (slot > 0 && distances[slot - 1] > distance) {
+                distances[slot] = distances[slot - 1];
+                entities[slot] = entities[slot - 1];
+                --slot;
+            }
+            distances[slot] = distance;
+            entities[slot] = entity;
+        }
+    };
+    
+    float finiteOr(float value, float fallback) noexcept {
+        return std::isfinite(value) ? value : fallback;
+    }
+    
+    PlayerInput toInput(const sd_action& action) noexcept {
+        PlayerInput input;
+        input.move.x = Utils::clamp(finiteOr(action.move_x, 0.0f), -1.0f, 1.0f);
+        input.move.y = Utils::clamp(finiteOr(action.move_y, 0.0f), -1.0f, 1.0f);
+        input.fire = finiteOr(action.fire, 0.0f) != 0.0f;
+        return input;
+    }
+    
+    struct EnvGame {
+        std::unique_ptr<Simulation> simulation;
+        uint32_t nextSeed = 0;
+        float scoreDelta = 0.0f;
+        bool done = false;
+        bool truncated = false;
+    };
+}
+
+struct sd_env {
+    RuntimeSettings settings;
+    SimulationAssets assets;
+    float tickLength = 1.0f / Config::TargetFPS;
+    uint32_t maxTicks = 0;
+    std::vector<EnvGame> games;
+    
+    // Steps run over chunks of games so each wake-up does a worthwhile amount of work
+    std::unique_ptr<WorkerPool> pool;
+    size_t chunkSize = 1;
+    
+    void restart(EnvGame& game) {
+        game.simulation->startNewGame(game.nextSeed);
+        game.nextSeed += static_cast<uint32_t>(games.size());
+        game.scoreDelta = 0.0f;
+        game.done = false;
+        game.truncated = false;
+    }
+    
+    // False if any game threw; an exception must not escape a pool thread, where it would terminate the process
+    template<typename Func>
+    bool forEachGame(Func&& func) const {
+        const size_t chunks = (games.size() + chunkSize - 1) / chunkSize;
+        std::atomic<bool> failed{false};
+        pool->forEach(chunks, [&](size_t chunk) {
+            try {
+                const size_t end = std::min(games.size(), (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i) {
+                    func(i);
+                }
+            } catch (...) {
+                failed = true;
+            }
+        });
+        return !failed;
+    }
+};
+
+namespace {
+    void observe(const EnvGame& game, sd_observation& out) {
+        out = sd_observation{};
+        const Simulation& simulation = *game.simulation;
+        out.score_delta = game.scoreDelta;
+        out.done = game.done ? 1.0f : 0.0f;
+        out.truncated = game.truncated ? 1.0f : 0.0f;
+        out.tick = static_cast<float>(simulation.getTick());
+        if (!simulation.isPlayerAlive()) return;
+        
+        const World& world = simulation.getWorld();
+        const Entity player = simulation.getPlayer();
+        const Transform& transform = *world.get<Transform>(player);
+        const sf::Vector2f position = transform.position;
+        const sf::Vector2f heading = PlayerSystem::getShootDirection(transform);
+        const Weapon* weapon = world.get<Weapon>(player);
+        const Health* health = world.get<Health>(player);
+        
+        const sf::Vector2f scale(1.0f / Config::WindowWidth, 1.0f / Config::WindowHeight);
+        out.player_x = position.x * scale.x;
+        out.player_y = position.y * scale.y;
+        out.heading_x = heading.x;
+        out.heading_y = heading.y;
+        out.health = health ? health->ratio() : 0.0f;
+        out.weapon_ready = weapon && weapon->ready() ? 1.0f : 0.0f;
+        
+        Nearest<SD_OBS_ENEMIES> enemies;
+        world.each<Transform, EnemyAI>([&](Entity entity, const Transform& enemy, const EnemyAI&) {
+            enemies.offer((enemy.position - position).lengthSquared(), entity);
+        });
+        for (size_t i = 0; i < enemies.count; ++i) {
+            const Entity entity = enemies.entities[i];
+            const sf::Vector2f offset = world.get<Transform>(entity)->position - position;
+            const Velocity* velocity = world.get<Velocity>(entity);
+            const Health* enemyHealth = world.get<Health>(entity);
+            auto& row = out.enemies[i];
+            row.present = 1.0f;
+            row.dx = offset.x * scale.x;
+            row.dy = offset.y * scale.y;
+            row.vx = velocity ? velocity->value.x * scale.x : 0.0f;
+            row.vy = velocity ? velocity->value.y * scale.y : 0.0f;
+            row.health = enemyHealth ? enemyHealth->ratio() : 0.0f;
+            row.type = static_cast<float>(world.get<EnemyAI>(entity)->type);
+        }
+        
+        Nearest<SD_OBS_BULLETS> bullets;
+        world.each<Transform, Projectile>([&](Entity entity, const Transform& bullet, const Projectile& projectile) {
+            if (!projectile.fromPlayer) {
+                bullets.offer((bullet.position - position).lengthSquared(), entity);
+            }
+        });
+        for (size_t i = 0; i < bullets.count; ++i) {
+            const Entity entity = bullets.entities[i];
+            const sf::Vector2f offset = world.get<Transform>(entity)->position - position;
+            const Velocity* velocity = world.get<Velocity>(entity);
+            auto& row = out.bullets[i];
+            row.present = 1.0f;
+            row.dx = offset.x * scale.x;
+            row.dy = offset.y * scale.y;
+            row.vx = velocity ? velocity->value.x * scale.x : 0.0f;
+            row.vy = velocity ? velocity->value.y * scale.y : 0.0f;
+        }
+    }
+}
+
+sd_env_config sd_env_default_config(void) {
+    sd_env_config config{};
+    config.num_envs = 1;
+    config.seed = 1;
+    config.threads = 0;
+    config.max_ticks = 0;
+    config.asset_mask = 0xFF;
+    config.profile = nullptr;
+    config.config_path = nullptr;
+    return config;
+}
+
+sd_env* sd_env_create(const sd_env_config* config) {
+    if (!config || config->num_envs == 0) return nullptr;
+    
+    // Nothing may throw across the C boundary
+    try {
+        auto env = std::make_unique<sd_env>();
+        if (config->profile) {
+            // Training against silently substituted defaults would waste the whole run
+            const std::string path = config->config_path ? std::string(config->config_path)
+                                                         : ResourceManager().resolvePath(Config::RuntimeConfigPath);
+            RuntimeConfig runtimeConfig;
+            if (!runtimeConfig.load(path, config->profile)) return nullptr;
+            env->settings = runtimeConfig.getSettings();
+        }
+        env->assets = SimulationAssets::placeholders(config->asset_mask);
+        env->tickLength = 1.0f / static_cast<float>(env->settings.targetFPS > 0 ? env->settings.targetFPS
+                                                                               : Config::TargetFPS);
+        env->maxTicks = config->max_ticks;
+        
+        env->games.resize(config->num_envs);
+        for (uint32_t i = 0; i < config->num_envs; ++i) {
+            EnvGame& game = env->games[i];
+            game.simulation = std::make_unique<Simulation>();
+            game.simulation->setAssets(env->assets);
+            game.simulation->applySettings(env->settings);
+            game.nextSeed = config->seed + i;
+            env->restart(game);
+        }
+        
+        // About four chunks per thread evens out games that take longer than others
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const unsigned int threads = static_cast<unsigned int>(
+            std::min<size_t>(config->threads > 0 ? config->threads : hardwareThreads, config->num_envs));
+        env->pool = std::make_unique<WorkerPool>(threads);
+        env->chunkSize = std::max<size_t>(1, config->num_envs / (threads * 4));
+        return env.release();
+    } catch (const std::exception& e) {
+        std::cerr << "sd_env_create failed: " << e.what() << std::endl;
+        return nullptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void sd_env_destroy(sd_env* env) {
+    delete env;
+}
+
+uint32_t sd_env_count(const sd_env* env) {
+    return env ? static_cast<uint32_t>(env->games.size()) : 0;
+}
+
+int sd_env_reset(sd_env* env) {
+    if (!env) return SD_ERROR_INVALID_ARGUMENT;
+    
+    try {
+        return env->forEachGame([env](size_t i) { env->restart(env->games[i]); }) ? SD_OK : SD_ERROR_GAME_FAILED;
+    } catch (...) {
+        return SD_ERROR_GAME_FAILED;
+    }
+}
+
+int sd_env_step_batch(sd_env* env, const sd_action* actions, size_t count) {
+    if (!env || !actions) return SD_ERROR_INVALID_ARGUMENT;
+    if (count != env->games.size()) return SD_ERROR_COUNT_MISMATCH;
+    
+    try {
+        const bool stepped = env->forEachGame([env, actions](size_t i) {
+            EnvGame& game = env->games[i];
+            if (game.done) {
+                env->restart(game);
+            }
+            
+            Simulation& simulation = *game.simulation;
+            const int scoreBefore = simulation.getScore();
+            simulation.step(toInput(actions[i]), env->tickLength);
+            game.scoreDelta = static_cast<float>(simulation.getScore() - scoreBefore);
+            game.truncated = env->maxTicks > 0 && simulation.getTick() >= env->maxTicks && !simulation.isGameOver();
+            game.done = simulation.isGameOver() || game.truncated;
+        });
+        return stepped ? SD_OK : SD_ERROR_GAME_FAILED;
+    } catch (...) {
+        return SD_ERROR_GAME_FAILED;
+    }
+}
+
+int sd_env_observe(const sd_env* env, sd_observation* out, size_t count) {
+    if (!env || !out) return SD_ERROR_INVALID_ARGUMENT;
+    if (count != env->games.size()) return SD_ERROR_COUNT_MISMATCH;
+    
+    try {
+        return env->forEachGame([env, out](size_t i) { observe(env->games[i], out[i]); }) ? SD_OK
+                                                                                           : SD_ERROR_GAME_FAILED;
+    } catch (...) {
+        return SD_ERROR_GAME_FAILED;
+    }
+}
\ No newline at end of file
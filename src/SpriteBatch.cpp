@@ -0,0 +1,186 @@
+#include "SpriteBatch.hpp"
+#include "MemoryReport.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr uint32_t SlotBits = 16;
+
+    // Rotate by degrees the way sf::Transformable does, then translate
+    struct Placement {
+        sf::Vector2f position;
+        float c, s;
+
+        Placement(const sf::Vector2f& at, float rotation) noexcept
+            : position(at), c(std::cos(Utils::degToRad(rotation))), s(std::sin(Utils::degToRad(rotation))) {}
+
+        [[nodiscard]] sf::Vector2f apply(const sf::Vector2f& local) const noexcept {
+            return sf::Vector2f(position.x + local.x * c - local.y * s, position.y + local.x * s + local.y * c);
+        }
+    };
+
+    // Unit normal of the edge a -> b, as sf::Shape computes it
+    sf::Vector2f edgeNormal(const sf::Vector2f& a, const sf::Vector2f& b) noexcept {
+        const sf::Vector2f normal(a.y - b.y, b.x - a.x);
+        const float length = Utils::vectorLength(normal);
+        return length != 0.0f ? normal / length : normal;
+    }
+
+    void pushTriangle(std::vector<sf::Vertex>& out, const sf::Vector2f& a, const sf::Vector2f& b,
+                      const sf::Vector2f& c, sf::Color color) {
+        out.push_back(sf::Vertex{a, color, {}});
+        out.push_back(sf::Vertex{b, color, {}});
+        out.push_back(sf::Vertex{c, color, {}});
+    }
+}
+
+SpriteBatch::SpriteBatch() {
+    m_textures.push_back(nullptr);
+}
+
+void SpriteBatch::drawSprite(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+                             const sf::Vector2f& size, float rotation, sf::Color color, RenderLayer layer) {
+    const size_t first = m_vertices.size();
+    const Placement placement(position, rotation);
+    const sf::Vector2f half = size * 0.5f;
+    const sf::Vector2f topLeft = placement.apply({-half.x, -half.y});
+    const sf::Vector2f topRight = placement.apply({half.x, -half.y});
+    const sf::Vector2f bottomLeft = placement.apply({-half.x, half.y});
+    const sf::Vector2f bottomRight = placement.apply({half.x, half.y});
+
+    const sf::Vector2f uvMin(textureRect.position);
+    const sf::Vector2f uvMax(textureRect.position + textureRect.size);
+
+    m_vertices.push_back(sf::Vertex{topLeft, color, uvMin});
+    m_vertices.push_back(sf::Vertex{topRight, color, {uvMax.x, uvMin.y}});
+    m_vertices.push_back(sf::Vertex{bottomLeft, color, {uvMin.x, uvMax.y}});
+    m_vertices.push_back(sf::Vertex{bottomLeft, color, {uvMin.x, uvMax.y}});
+    m_vertices.push_back(sf::Vertex{topRight, color, {uvMax.x, uvMin.y}});
+    m_vertices.push_back(sf::Vertex{bottomRight, color, uvMax});
+
+    pushItem(layer, textureSlot(&texture), first);
+}
+
+void SpriteBatch::drawConvex(const sf::Vector2f* points, size_t count, const sf::Vector2f& position, float rotation,
+                             sf::Color fill, float outlineThickness, sf::Color outline, RenderLayer layer) {
+    if (count < 3) return;
+
+    const size_t first = m_vertices.size();
+    const Placement placement(position, rotation);
+    m_points.resize(count);
+    sf::Vector2f center;
+    for (size_t i = 0; i < count; ++i) {
+        m_points[i] = placement.apply(points[i]);
+        center += m_points[i];
+    }
+    center /= static_cast<float>(count);
+
+    for (size_t i = 1; i + 1 < count; ++i) {
+        pushTriangle(m_vertices, m_points[0], m_points[i], m_points[i + 1], fill);
+    }
+
+    if (outlineThickness > 0.0f) {
+        // Same miter as sf::Shape: push each point out along its averaged edge normals
+        const auto outer = [&](size_t i) {
+            const sf::Vector2f& previous = m_points[(i + count - 1) % count];
+            const sf::Vector2f& point = m_points[i];
+            const sf::Vector2f& next = m_points[(i + 1) % count];
+            sf::Vector2f n1 = edgeNormal(previous, point);
+            sf::Vector2f n2 = edgeNormal(point, next);
+            if (n1.dot(center - point) > 0.0f) n1 = -n1;
+            if (n2.dot(center - point) > 0.0f) n2 = -n2;
+            const float factor = 1.0f + n1.dot(n2);
+            return point + (n1 + n2) / factor * outlineThickness;
+        };
+
+        sf::Vector2f outerFirst = outer(0);
+        sf::Vector2f outerCurrent = outerFirst;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t j = (i + 1) % count;
+            const sf::Vector2f outerNext = j == 0 ? outerFirst : outer(j);
+            pushTriangle(m_vertices, m_points[i], outerCurrent, m_points[j], outline);
+            pushTriangle(m_vertices, m_points[j], outerCurrent, outerNext, outline);
+            outerCurrent = outerNext;
+        }
+    }
+
+    pushItem(layer, 0, first);
+}
+
+void SpriteBatch::drawRect(const sf::FloatRect& rect, sf::Color fill, RenderLayer layer) {
+    const size_t first = m_vertices.size();
+    const sf::Vector2f topLeft = rect.position;
+    const sf::Vector2f bottomRight = rect.position + rect.size;
+    const sf::Vector2f topRight(bottomRight.x, topLeft.y);
+    const sf::Vector2f bottomLeft(topLeft.x, bottomRight.y);
+
+    pushTriangle(m_vertices, topLeft, topRight, bottomLeft, fill);
+    pushTriangle(m_vertices, bottomLeft, topRight, bottomRight, fill);
+    pushItem(layer, 0, first);
+}
+
+void SpriteBatch::drawTriangles(const sf::Texture* texture, const sf::Vertex* vertices, size_t count,
+                                RenderLayer layer) {
+    if (count == 0) return;
+
+    const size_t first = m_vertices.size();
+    m_vertices.insert(m_vertices.end(), vertices, vertices + count);
+    pushItem(layer, textureSlot(texture), first);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target, FrameArena& arena) {
+    m_stats = Statistics{m_items.size(), m_vertices.size(), 0};
+
+    // Equal keys keep submission order. Items are submitted in vertex order, so
+    // breaking ties on firstVertex sorts stably without stable_sort's heap buffer
+    std::sort(m_items.begin(), m_items.end(), [](const Item& a, const Item& b) {
+        return a.key != b.key ? a.key < b.key : a.firstVertex < b.firstVertex;
+    });
+
+    FrameVector<sf::Vertex> sortedVertices{ArenaAllocator<sf::Vertex>(arena)};
+    sortedVertices.reserve(m_vertices.size());
+
+    const uint32_t slotMask = (1u << SlotBits) - 1;
+    size_t runStart = 0;
+    for (size_t i = 0; i < m_items.size(); ++i) {
+        const Item& item = m_items[i];
+        sortedVertices.insert(sortedVertices.end(), m_vertices.begin() + item.firstVertex,
+                              m_vertices.begin() + item.firstVertex + item.vertexCount);
+
+        // A run ends where the texture changes; layers alone don't split it
+        const uint32_t slot = item.key & slotMask;
+        const bool lastOfRun = i + 1 == m_items.size() || (m_items[i + 1].key & slotMask) != slot;
+        if (lastOfRun) {
+            sf::RenderStates states;
+            states.texture = m_textures[slot];
+            target.draw(sortedVertices.data() + runStart, sortedVertices.size() - runStart,
+                        sf::PrimitiveType::Triangles, states);
+            m_stats.drawCalls++;
+            runStart = sortedVertices.size();
+        }
+    }
+
+    m_vertices.clear();
+    m_items.clear();
+    // Textures may be reloaded between frames, so slots last one frame
+    m_textures.resize(1);
+}
+
+uint32_t SpriteBatch::textureSlot(const sf::Texture* texture) {
+    const auto found = std::find(m_textures.begin(), m_textures.end(), texture);
+    if (found != m_textures.end()) {
+        return static_cast<uint32_t>(found - m_textures.begin());
+    }
+    m_textures.push_back(texture);
+    return static_cast<uint32_t>(m_textures.size() - 1);
+}
+
+void SpriteBatch::pushItem(RenderLayer layer, uint32_t slot, size_t firstVertex) {
+    const uint32_t key = (static_cast<uint32_t>(layer) << SlotBits) | slot;
+    const auto vertexCount = static_cast<uint32_t>(m_vertices.size() - firstVertex);
+    m_items.push_back({key, static_cast<uint32_t>(firstVertex), vertexCount});
+}
+
+size_t SpriteBatch::memoryBytes() const noexcept {
+    return MemoryReport::capacityBytes(m_vertices, m_items, m_textures, m_points);
+}
\ No newline at end of file
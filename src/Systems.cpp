@@ -0,0 +1,112 @@
+#include "Systems.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cmath>
+
+namespace {
+    constexpr size_t CirclePoints = 30;         // sf::CircleShape's default
+    constexpr size_t SmallCirclePoints = 8;     // Plenty for a few-pixel spark
+
+    template<size_t N>
+    const std::array<sf::Vector2f, N>& unitCircle() {
+        // Starts at the top like sf::CircleShape
+        static const std::array<sf::Vector2f, N> points = [] {
+            std::array<sf::Vector2f, N> result;
+            for (size_t i = 0; i < N; ++i) {
+                const float angle = static_cast<float>(i) * Config::TwoPi / static_cast<float>(N) - Config::Pi * 0.5f;
+                result[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+            }
+            return result;
+        }();
+        return points;
+    }
+
+    template<size_t N>
+    void drawCircle(const sf::Vector2f& position, const ShapeVisual& visual, SpriteBatch& batch) {
+        std::array<sf::Vector2f, N> points;
+        const auto& unit = unitCircle<N>();
+        for (size_t i = 0; i < N; ++i) {
+            points[i] = unit[i] * visual.radius;
+        }
+        batch.drawConvex(points.data(), N, position, 0.0f, visual.fill, visual.outlineThickness,
+                         visual.outline, visual.layer);
+    }
+
+    void drawShape(const RenderSnapshot::Shape& shape, SpriteBatch& batch) {
+        const ShapeVisual& visual = shape.visual;
+        if (visual.kind == ShapeVisual::Kind::Ship) {
+            // Arrowhead pointing along +x, sized so radius is the nose distance, pivoting r/4 behind the nose
+            const float r = visual.radius;
+            const sf::Vector2f pivot(r * 0.25f, 0.0f);
+            const sf::Vector2f points[] = {sf::Vector2f(r, 0.0f) - pivot, sf::Vector2f(-r * 0.5f, -r * 0.5f) - pivot,
+                                           sf::Vector2f(-r * 0.5f, r * 0.5f) - pivot};
+            batch.drawConvex(points, 3, shape.position, shape.rotation, visual.fill, visual.outlineThickness,
+                             visual.outline, visual.layer);
+        } else if (visual.radius <= 4.0f) {
+            drawCircle<SmallCirclePoints>(shape.position, visual, batch);
+        } else {
+            drawCircle<CirclePoints>(shape.position, visual, batch);
+        }
+    }
+}
+
+namespace Systems {
+    void integrateMotion(World& world, float deltaTime) noexcept {
+        world.each<Transform, Velocity>([deltaTime](Transform& transform, const Velocity& velocity) {
+            transform.position += velocity.value * deltaTime;
+        });
+    }
+
+    size_t updateBounds(World& world) noexcept {
+        size_t rebuilt = 0;
+        world.each<Transform, Collider, Bounds>([&rebuilt](const Transform& transform, const Collider& collider,
+                                                           Bounds& bounds) {
+            rebuilt += bounds.refresh(transform, collider);
+        });
+        return rebuilt;
+    }
+
+    void capture(const World& world, RenderSnapshot& snapshot, bool debugBounds) {
+        snapshot.clear();
+        world.each<Transform, SpriteVisual>([&snapshot](const Transform& transform, const SpriteVisual& visual) {
+            if (!visual.texture) return;
+            snapshot.sprites.push_back({visual.texture, visual.textureRect, transform.position, visual.size,
+                                        transform.rotation + visual.rotationOffset, visual.color, visual.layer});
+        });
+        world.each<Transform, ShapeVisual>([&snapshot](const Transform& transform, const ShapeVisual& visual) {
+            snapshot.shapes.push_back({transform.position, transform.rotation, visual});
+        });
+        if (debugBounds) {
+            world.each<Collider, Bounds>([&snapshot](const Collider& collider, const Bounds& bounds) {
+                snapshot.debugBoxes.push_back({bounds.collision, collider.debugColor});
+            });
+        }
+    }
+
+    void draw(const RenderSnapshot& snapshot, SpriteBatch& batch) {
+        for (const RenderSnapshot::Sprite& sprite : snapshot.sprites) {
+            batch.drawSprite(*sprite.texture, sprite.textureRect, sprite.position, sprite.size, sprite.rotation,
+                             sprite.color, sprite.layer);
+        }
+        for (const RenderSnapshot::Shape& shape : snapshot.shapes) {
+            drawShape(shape, batch);
+        }
+    }
+
+    void drawDebugBounds(const RenderSnapshot& snapshot, SpriteBatch& batch) {
+        for (const RenderSnapshot::DebugBox& debug : snapshot.debugBoxes) {
+            // 2px outline just outside the box, like an outlined sf::RectangleShape
+            constexpr float thickness = 2.0f;
+            const sf::FloatRect& box = debug.box;
+            const sf::Vector2f outer = box.position - sf::Vector2f(thickness, thickness);
+            const float width = box.size.x + 2.0f * thickness;
+            batch.drawRect(sf::FloatRect(outer, {width, thickness}), debug.color, RenderLayer::Hud);
+            batch.drawRect(sf::FloatRect({outer.x, box.position.y + box.size.y}, {width, thickness}), debug.color,
+                           RenderLayer::Hud);
+            batch.drawRect(sf::FloatRect({outer.x, box.position.y}, {thickness, box.size.y}), debug.color,
+                           RenderLayer::Hud);
+            batch.drawRect(sf::FloatRect({box.position.x + box.size.x, box.position.y}, {thickness, box.size.y}),
+                           debug.color, RenderLayer::Hud);
+        }
+    }
+}
\ No newline at end of file
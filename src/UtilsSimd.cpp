@@ -0,0 +1,424 @@
+#include "UtilsSimd.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define SPACEDEFENDER_SIMD_SSE2 1
+#endif
+
+// AVX2 kernels are compiled per function, so the rest of the binary stays baseline x86-64
+#if defined(SPACEDEFENDER_SIMD_SSE2) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define SPACEDEFENDER_SIMD_AVX2 1
+    #define SPACEDEFENDER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace {
+    using Utils::Simd::Isa;
+
+    constexpr float Pi = 3.14159265358979f;
+    constexpr float HalfPi = 1.57079632679490f;
+    constexpr float FourOverPi = 1.27323954473516f;
+
+    // Cephes sinf/cosf: three-part pi/4 for range reduction, minimax polynomials on [-pi/4, pi/4]
+    constexpr float ReduceA = 0.78515625f;
+    constexpr float ReduceB = 2.4187564849853515625e-4f;
+    constexpr float ReduceC = 3.77489497744594108e-8f;
+    constexpr float Sin0 = -1.9515295891e-4f, Sin1 = 8.3321608736e-3f, Sin2 = -1.6666654611e-1f;
+    constexpr float Cos0 = 2.443315711809948e-5f, Cos1 = -1.388731625493765e-3f, Cos2 = 4.166664568298827e-2f;
+
+    // Abramowitz & Stegun 4.4.49: atan on [0, 1] within 2e-8 before float rounding
+    constexpr float Atan[8] = {-0.3333314528f, 0.1999355085f, -0.1420889944f, 0.1065626393f,
+                               -0.0752896400f, 0.0429096138f, -0.0161657367f, 0.0028662257f};
+
+    struct Kernels {
+        Isa isa;
+        void (*normalize)(float*, float*, size_t) noexcept;
+        void (*sincos)(const float*, float*, float*, size_t) noexcept;
+        void (*atan2)(const float*, const float*, float*, size_t) noexcept;
+        size_t (*overlapping)(const float*, const float*, const float*, const float*, size_t,
+                              const sf::FloatRect&, uint32_t*) noexcept;
+    };
+
+    // Scalar reference. The vector kernels below repeat these steps lane by lane
+    namespace scalar {
+        void normalize(float* x, float* y, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                const float lengthSquared = x[i] * x[i] + y[i] * y[i];
+                if (lengthSquared > 0.0f) {
+                    const float invLength = 1.0f / std::sqrt(lengthSquared);
+                    x[i] *= invLength;
+                    y[i] *= invLength;
+                }
+            }
+        }
+
+        void sincos(const float* radians, float* sines, float* cosines, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                const float ax = std::abs(radians[i]);
+
+                // Octant, rounded up to even so the reduced angle lands in [-pi/4, pi/4]
+                const int32_t octant = (static_cast<int32_t>(ax * FourOverPi) + 1) & ~1;
+                const float k = static_cast<float>(octant);
+                const float r = ((ax - k * ReduceA) - k * ReduceB) - k * ReduceC;
+                const float z = r * r;
+
+                const float cosPoly = ((Cos0 * z + Cos1) * z + Cos2) * z * z - z * 0.5f + 1.0f;
+                const float sinPoly = ((Sin0 * z + Sin1) * z + Sin2) * z * r + r;
+
+                const bool swap = (octant & 2) != 0;
+                const float s = swap ? cosPoly : sinPoly;
+                const float c = swap ? sinPoly : cosPoly;
+                const bool negateSin = std::signbit(radians[i]) != ((octant & 4) != 0);
+                const bool negateCos = ((octant - 2) & 4) == 0;
+                sines[i] = negateSin ? -s : s;
+                cosines[i] = negateCos ? -c : c;
+            }
+        }
+
+        void atan2(const float* y, const float* x, float* radians, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                const float ax = std::abs(x[i]);
+                const float ay = std::abs(y[i]);
+                const float high = std::max(ax, ay);
+                const float ratio = high > 0.0f ? std::min(ax, ay) / high : 0.0f;
+                const float s = ratio * ratio;
+
+                float p = Atan[7];
+                for (int k = 6; k >= 0; --k) {
+                    p = p * s + Atan[k];
+                }
+                float r = p * s * ratio + ratio;
+                r = ay > ax ? HalfPi - r : r;
+                r = x[i] < 0.0f ? Pi - r : r;
+                radians[i] = std::copysign(r, y[i]);
+            }
+        }
+
+        size_t overlapping(const float* left, const float* top, const float* right, const float* bottom,
+                           size_t count, const sf::FloatRect& box, uint32_t* indices) noexcept {
+            const float boxLeft = box.position.x;
+            const float boxTop = box.position.y;
+            const float boxRight = box.position.x + box.size.x;
+            const float boxBottom = box.position.y + box.size.y;
+
+            size_t found = 0;
+            for (size_t i = 0; i < count; ++i) {
+                indices[found] = static_cast<uint32_t>(i);
+                found += (left[i] < boxRight) & (right[i] > boxLeft) & (top[i] < boxBottom) & (bottom[i] > boxTop);
+            }
+            return found;
+        }
+    }
+
+#if defined(SPACEDEFENDER_SIMD_SSE2)
+    namespace sse2 {
+        constexpr size_t Lanes = 4;
+
+        inline __m128 select(__m128 mask, __m128 a, __m128 b) noexcept {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        void normalize(float* x, float* y, size_t count) noexcept {
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m128 vx = _mm_loadu_ps(x + i);
+                const __m128 vy = _mm_loadu_ps(y + i);
+                const __m128 lengthSquared = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+                const __m128 valid = _mm_cmpgt_ps(lengthSquared, _mm_setzero_ps());
+                const __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquared));
+                _mm_storeu_ps(x + i, select(valid, _mm_mul_ps(vx, invLength), vx));
+                _mm_storeu_ps(y + i, select(valid, _mm_mul_ps(vy, invLength), vy));
+            }
+            scalar::normalize(x + i, y + i, count - i);
+        }
+
+        void sincos(const float* radians, float* sines, float* cosines, size_t count) noexcept {
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m128 angle = _mm_loadu_ps(radians + i);
+                const __m128 ax = _mm_andnot_ps(signMask, angle);
+
+                const __m128i octant = _mm_and_si128(
+                    _mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(ax, _mm_set1_ps(FourOverPi))), _mm_set1_epi32(1)),
+                    _mm_set1_epi32(~1));
+                const __m128 k = _mm_cvtepi32_ps(octant);
+                __m128 r = _mm_sub_ps(ax, _mm_mul_ps(k, _mm_set1_ps(ReduceA)));
+                r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(ReduceB)));
+                r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(ReduceC)));
+                const __m128 z = _mm_mul_ps(r, r);
+
+                __m128 cosPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Cos0), z), _mm_set1_ps(Cos1));
+                cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(Cos2));
+                cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+                cosPoly = _mm_add_ps(_mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+                __m128 sinPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Sin0), z), _mm_set1_ps(Sin1));
+                sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(Sin2));
+                sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), r), r);
+
+                const __m128 swap = _mm_castsi128_ps(
+                    _mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+                const __m128 sinSign = _mm_xor_ps(_mm_and_ps(angle, signMask), _mm_castsi128_ps(
+                    _mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29)));
+                const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(
+                    _mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+
+                _mm_storeu_ps(sines + i, _mm_xor_ps(select(swap, cosPoly, sinPoly), sinSign));
+                _mm_storeu_ps(cosines + i, _mm_xor_ps(select(swap, sinPoly, cosPoly), cosSign));
+            }
+            scalar::sincos(radians + i, sines + i, cosines + i, count - i);
+        }
+
+        void atan2(const float* y, const float* x, float* radians, size_t count) noexcept {
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m128 vx = _mm_loadu_ps(x + i);
+                const __m128 vy = _mm_loadu_ps(y + i);
+                const __m128 ax = _mm_andnot_ps(signMask, vx);
+                const __m128 ay = _mm_andnot_ps(signMask, vy);
+                const __m128 high = _mm_max_ps(ax, ay);
+                const __m128 ratio = _mm_and_ps(_mm_cmpgt_ps(high, _mm_setzero_ps()),
+                                                _mm_div_ps(_mm_min_ps(ax, ay), high));
+                const __m128 s = _mm_mul_ps(ratio, ratio);
+
+                __m128 p = _mm_set1_ps(Atan[7]);
+                for (int k = 6; k >= 0; --k) {
+                    p = _mm_add_ps(_mm_mul_ps(p, s), _mm_set1_ps(Atan[k]));
+                }
+                __m128 r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, s), ratio), ratio);
+                r = select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(HalfPi), r), r);
+                r = select(_mm_cmplt_ps(vx, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(Pi), r), r);
+                _mm_storeu_ps(radians + i, _mm_or_ps(r, _mm_and_ps(vy, signMask)));
+            }
+            scalar::atan2(y + i, x + i, radians + i, count - i);
+        }
+
+        size_t overlapping(const float* left, const float* top, const float* right, const float* bottom,
+                           size_t count, const sf::FloatRect& box, uint32_t* indices) noexcept {
+            const __m128 boxLeft = _mm_set1_ps(box.position.x);
+            const __m128 boxTop = _mm_set1_ps(box.position.y);
+            const __m128 boxRight = _mm_set1_ps(box.position.x + box.size.x);
+            const __m128 boxBottom = _mm_set1_ps(box.position.y + box.size.y);
+
+            size_t found = 0;
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m128 inX = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(left + i), boxRight),
+                                              _mm_cmpgt_ps(_mm_loadu_ps(right + i), boxLeft));
+                const __m128 inY = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(top + i), boxBottom),
+                                              _mm_cmpgt_ps(_mm_loadu_ps(bottom + i), boxTop));
+                auto bits = static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(inX, inY)));
+                while (bits != 0) {
+                    indices[found++] = static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                }
+            }
+
+            const size_t tail = scalar::overlapping(left + i, top + i, right + i, bottom + i, count - i, box,
+                                                    indices + found);
+            for (size_t k = 0; k < tail; ++k) {
+                indices[found + k] += static_cast<uint32_t>(i);
+            }
+            return found + tail;
+        }
+    }
+#endif
+
+#if defined(SPACEDEFENDER_SIMD_AVX2)
+    // Same steps as sse2, eight lanes wide. No FMA, so results match the other kernels exactly
+    namespace avx2 {
+        constexpr size_t Lanes = 8;
+
+        SPACEDEFENDER_TARGET_AVX2 inline __m256 select(__m256 mask, __m256 a, __m256 b) noexcept {
+            return _mm256_blendv_ps(b, a, mask);
+        }
+
+        SPACEDEFENDER_TARGET_AVX2 void normalize(float* x, float* y, size_t count) noexcept {
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m256 vx = _mm256_loadu_ps(x + i);
+                const __m256 vy = _mm256_loadu_ps(y + i);
+                const __m256 lengthSquared = _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy));
+                const __m256 valid = _mm256_cmp_ps(lengthSquared, _mm256_setzero_ps(), _CMP_GT_OQ);
+                const __m256 invLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(lengthSquared));
+                _mm256_storeu_ps(x + i, select(valid, _mm256_mul_ps(vx, invLength), vx));
+                _mm256_storeu_ps(y + i, select(valid, _mm256_mul_ps(vy, invLength), vy));
+            }
+            sse2::normalize(x + i, y + i, count - i);
+        }
+
+        SPACEDEFENDER_TARGET_AVX2 void sincos(const float* radians, float* sines, float* cosines,
+                                              size_t count) noexcept {
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m256 angle = _mm256_loadu_ps(radians + i);
+                const __m256 ax = _mm256_andnot_ps(signMask, angle);
+
+                const __m256i octant = _mm256_and_si256(
+                    _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(ax, _mm256_set1_ps(FourOverPi))),
+                                     _mm256_set1_epi32(1)),
+                    _mm256_set1_epi32(~1));
+                const __m256 k = _mm256_cvtepi32_ps(octant);
+                __m256 r = _mm256_sub_ps(ax, _mm256_mul_ps(k, _mm256_set1_ps(ReduceA)));
+                r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(ReduceB)));
+                r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(ReduceC)));
+                const __m256 z = _mm256_mul_ps(r, r);
+
+                __m256 cosPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Cos0), z), _mm256_set1_ps(Cos1));
+                cosPoly = _mm256_add_ps(_mm256_mul_ps(cosPoly, z), _mm256_set1_ps(Cos2));
+                cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+                cosPoly = _mm256_add_ps(_mm256_sub_ps(cosPoly, _mm256_mul_ps(z, _mm256_set1_ps(0.5f))),
+                                        _mm256_set1_ps(1.0f));
+
+                __m256 sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Sin0), z), _mm256_set1_ps(Sin1));
+                sinPoly = _mm256_add_ps(_mm256_mul_ps(sinPoly, z), _mm256_set1_ps(Sin2));
+                sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sinPoly, z), r), r);
+
+                const __m256 swap = _mm256_castsi256_ps(
+                    _mm256_cmpeq_epi32(_mm256_and_si256(octant, _mm256_set1_epi32(2)), _mm256_set1_epi32(2)));
+                const __m256 sinSign = _mm256_xor_ps(_mm256_and_ps(angle, signMask), _mm256_castsi256_ps(
+                    _mm256_slli_epi32(_mm256_and_si256(octant, _mm256_set1_epi32(4)), 29)));
+                const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(
+                    _mm256_andnot_si256(_mm256_sub_epi32(octant, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+
+                _mm256_storeu_ps(sines + i, _mm256_xor_ps(select(swap, cosPoly, sinPoly), sinSign));
+                _mm256_storeu_ps(cosines + i, _mm256_xor_ps(select(swap, sinPoly, cosPoly), cosSign));
+            }
+            sse2::sincos(radians + i, sines + i, cosines + i, count - i);
+        }
+
+        SPACEDEFENDER_TARGET_AVX2 void atan2(const float* y, const float* x, float* radians, size_t count) noexcept {
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m256 vx = _mm256_loadu_ps(x + i);
+                const __m256 vy = _mm256_loadu_ps(y + i);
+                const __m256 ax = _mm256_andnot_ps(signMask, vx);
+                const __m256 ay = _mm256_andnot_ps(signMask, vy);
+                const __m256 high = _mm256_max_ps(ax, ay);
+                const __m256 ratio = _mm256_and_ps(_mm256_cmp_ps(high, _mm256_setzero_ps(), _CMP_GT_OQ),
+                                                   _mm256_div_ps(_mm256_min_ps(ax, ay), high));
+                const __m256 s = _mm256_mul_ps(ratio, ratio);
+
+                __m256 p = _mm256_set1_ps(Atan[7]);
+                for (int k = 6; k >= 0; --k) {
+                    p = _mm256_add_ps(_mm256_mul_ps(p, s), _mm256_set1_ps(Atan[k]));
+                }
+                __m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, s), ratio), ratio);
+                r = select(_mm256_cmp_ps(ay, ax, _CMP_GT_OQ), _mm256_sub_ps(_mm256_set1_ps(HalfPi), r), r);
+                r = select(_mm256_cmp_ps(vx, _mm256_setzero_ps(), _CMP_LT_OQ),
+                           _mm256_sub_ps(_mm256_set1_ps(Pi), r), r);
+                _mm256_storeu_ps(radians + i, _mm256_or_ps(r, _mm256_and_ps(vy, signMask)));
+            }
+            sse2::atan2(y + i, x + i, radians + i, count - i);
+        }
+
+        SPACEDEFENDER_TARGET_AVX2 size_t overlapping(const float* left, const float* top, const float* right,
+                                                     const float* bottom, size_t count, const sf::FloatRect& box,
+                                                     uint32_t* indices) noexcept {
+            const __m256 boxLeft = _mm256_set1_ps(box.position.x);
+            const __m256 boxTop = _mm256_set1_ps(box.position.y);
+            const __m256 boxRight = _mm256_set1_ps(box.position.x + box.size.x);
+            const __m256 boxBottom = _mm256_set1_ps(box.position.y + box.size.y);
+
+            size_t found = 0;
+            size_t i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+                const __m256 inX = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(left + i), boxRight, _CMP_LT_OQ),
+                                                 _mm256_cmp_ps(_mm256_loadu_ps(right + i), boxLeft, _CMP_GT_OQ));
+                const __m256 inY = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(top + i), boxBottom, _CMP_LT_OQ),
+                                                 _mm256_cmp_ps(_mm256_loadu_ps(bottom + i), boxTop, _CMP_GT_OQ));
+                auto bits = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(inX, inY)));
+                while (bits != 0) {
+                    indices[found++] = static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                }
+            }
+
+            const size_t tail = sse2::overlapping(left + i, top + i, right + i, bottom + i, count - i, box,
+                                                  indices + found);
+            for (size_t k = 0; k < tail; ++k) {
+                indices[found + k] += static_cast<uint32_t>(i);
+            }
+            return found + tail;
+        }
+    }
+#endif
+
+    Isa supportedIsa() noexcept {
+#if defined(SPACEDEFENDER_SIMD_AVX2)
+        // Also checks that the OS saves the AVX registers
+        if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+#endif
+#if defined(SPACEDEFENDER_SIMD_SSE2)
+        return Isa::SSE2;
+#else
+        return Isa::Scalar;
+#endif
+    }
+
+    Kernels kernelsFor(Isa isa) noexcept {
+        switch (isa) {
+#if defined(SPACEDEFENDER_SIMD_AVX2)
+            case Isa::AVX2:
+                return {Isa::AVX2, avx2::normalize, avx2::sincos, avx2::atan2, avx2::overlapping};
+#endif
+#if defined(SPACEDEFENDER_SIMD_SSE2)
+            case Isa::SSE2:
+                return {Isa::SSE2, sse2::normalize, sse2::sincos, sse2::atan2, sse2::overlapping};
+#endif
+            default:
+                break;
+        }
+        return {Isa::Scalar, scalar::normalize, scalar::sincos, scalar::atan2, scalar::overlapping};
+    }
+
+    Kernels& active() noexcept {
+        static Kernels kernels = kernelsFor(supportedIsa());
+        return kernels;
+    }
+}
+
+namespace Utils::Simd {
+    Isa activeIsa() noexcept {
+        return active().isa;
+    }
+
+    const char* isaName(Isa isa) noexcept {
+        switch (isa) {
+            case Isa::Scalar: return "scalar";
+            case Isa::SSE2: return "SSE2";
+            case Isa::AVX2: return "AVX2";
+        }
+        return "unknown";
+    }
+
+    Isa selectIsa(Isa requested) noexcept {
+        const Isa supported = supportedIsa();
+        active() = kernelsFor(static_cast<int>(requested) < static_cast<int>(supported) ? requested : supported);
+        return active().isa;
+    }
+
+    void normalize(float* x, float* y, size_t count) noexcept {
+        active().normalize(x, y, count);
+    }
+
+    void sincos(const float* radians, float* sines, float* cosines, size_t count) noexcept {
+        active().sincos(radians, sines, cosines, count);
+    }
+
+    void atan2(const float* y, const float* x, float* radians, size_t count) noexcept {
+        active().atan2(y, x, radians, count);
+    }
+
+    size_t overlapping(const float* left, const float* top, const float* right, const float* bottom, size_t count,
+                       const sf::FloatRect& box, uint32_t* indices) noexcept {
+        return active().overlapping(left, top, right, bottom, count, box, indices);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,358 @@
+#include "World.hpp"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace {
+    // Guarded so independent Worlds on different threads can register components
+    std::mutex g_registryMutex;
+    std::vector<size_t> g_componentSizes;
+}
+
+// ComponentRegistry Implementation
+ComponentId ComponentRegistry::registerComponent(size_t size) {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    GAME_ASSERT(g_componentSizes.size() < MaxComponents, "Too many component types");
+    g_componentSizes.push_back(size);
+    return static_cast<ComponentId>(g_componentSizes.size() - 1);
+}
+
+size_t ComponentRegistry::sizeOf(ComponentId id) {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    return g_componentSizes[id];
+}
+
+size_t ComponentRegistry::count() {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    return g_componentSizes.size();
+}
+
+// Archetype Implementation
+Archetype::Archetype(ComponentMask mask) : m_mask(mask) {
+    m_columnIndex.fill(NoColumn);
+    addEdges.fill(NoEdge);
+    removeEdges.fill(NoEdge);
+
+    for (ComponentId id = 0; id < MaxComponents; ++id) {
+        if (mask & (ComponentMask{1} << id)) {
+            m_columnIndex[id] = static_cast<uint8_t>(m_columns.size());
+            m_columns.push_back({id, ComponentRegistry::sizeOf(id), {}});
+        }
+    }
+}
+
+uint32_t Archetype::pushRow(Entity entity) {
+    const auto row = static_cast<uint32_t>(m_entities.size());
+    for (Column& column : m_columns) {
+        column.data.resize(column.data.size() + column.elementSize);
+    }
+    m_entities.push_back(entity);
+    return row;
+}
+
+Entity Archetype::swapRemove(uint32_t row) noexcept {
+    const size_t last = m_entities.size() - 1;
+    Entity moved;
+
+    if (row != last) {
+        for (Column& column : m_columns) {
+            std::memcpy(column.data.data() + row * column.elementSize,
+                        column.data.data() + last * column.elementSize, column.elementSize);
+        }
+        m_entities[row] = m_entities[last];
+        moved = m_entities[row];
+    }
+
+    for (Column& column : m_columns) {
+        column.data.resize(column.data.size() - column.elementSize);
+    }
+    m_entities.pop_back();
+    return moved;
+}
+
+void Archetype::copyRow(uint32_t row, Archetype& from, uint32_t fromRow) noexcept {
+    for (Column& column : m_columns) {
+        if (const std::byte* source = from.columnData(column.id)) {
+            std::memcpy(column.data.data() + row * column.elementSize,
+                        source + fromRow * column.elementSize, column.elementSize);
+        }
+    }
+}
+
+void Archetype::reserve(size_t rows) {
+    for (Column& column : m_columns) {
+        column.data.reserve(rows * column.elementSize);
+    }
+    m_entities.reserve(rows);
+}
+
+size_t Archetype::capacityBytes() const noexcept {
+    size_t bytes = m_columns.capacity() * sizeof(Column) + m_entities.capacity() * sizeof(Entity);
+    for (const Column& column : m_columns) {
+        bytes += column.data.capacity();
+    }
+    return bytes;
+}
+
+void Archetype::clear() noexcept {
+    for (Column& column : m_columns) {
+        column.data.clear();
+    }
+    m_entities.clear();
+}
+
+void Archetype::save(BinaryWriter& writer, const ComponentEncoder& encoder) const {
+    writer.writeVector(m_entities);
+    for (const Column& column : m_columns) {
+        writer.write(static_cast<uint32_t>(column.elementSize));
+        if (column.id != encoder.component || !encoder.encode) {
+            writer.writeVector(column.data);
+            continue;
+        }
+
+        // Same layout as writeVector, with each saved element passed through the encoder
+        writer.write(static_cast<uint64_t>(column.data.size()));
+        std::byte* saved = writer.appendBytes(column.data.size());
+        if (column.data.empty()) continue;
+        std::memcpy(saved, column.data.data(), column.data.size());
+        for (size_t offset = 0; offset < column.data.size(); offset += column.elementSize) {
+            encoder.encode(saved + offset, encoder.context);
+        }
+    }
+}
+
+bool Archetype::load(BinaryReader& reader) {
+    if (!reader.readVector(m_entities)) return false;
+    
+    for (Column& column : m_columns) {
+        uint32_t elementSize = 0;
+        if (!reader.read(elementSize) || elementSize != column.elementSize || !reader.readVector(column.data) ||
+            column.data.size() != m_entities.size() * column.elementSize) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// World Implementation
+World::World() {
+    // Archetype 0 is the empty set, so every lookup below has a valid start
+    archetypeFor(0);
+}
+
+Entity World::allocateEntity() {
+    uint32_t index;
+    if (!m_freeIds.empty()) {
+        index = m_freeIds.back();
+        m_freeIds.pop_back();
+    } else {
+        GAME_ASSERT(m_records.size() <= Entity::MaxIndex, "Entity index space exhausted");
+        index = static_cast<uint32_t>(m_records.size());
+        m_records.emplace_back();
+    }
+
+    EntityRecord& record = m_records[index];
+    record.alive = true;
+    record.pendingDestroy = false;
+
+    m_stats.entityCount++;
+    m_stats.peakEntities = std::max(m_stats.peakEntities, m_stats.entityCount);
+    return Entity(index, record.generation);
+}
+
+uint32_t World::archetypeFor(ComponentMask mask) {
+    if (auto it = m_archetypeByMask.find(mask); it != m_archetypeByMask.end()) {
+        return it->second;
+    }
+
+    GAME_ASSERT(m_iterationDepth == 0, "New archetype created inside each()");
+    const auto index = static_cast<uint32_t>(m_archetypes.size());
+    m_archetypes.push_back(std::make_unique<Archetype>(mask));
+    m_archetypeByMask.emplace(mask, index);
+    m_stats.archetypeCount = m_archetypes.size();
+    return index;
+}
+
+uint32_t World::moveEntity(Entity entity, ComponentId id, bool adding) {
+    GAME_ASSERT(m_iterationDepth == 0, "World::add/remove inside each()");
+    EntityRecord& record = m_records[entity.index()];
+
+    auto& edges = adding ? m_archetypes[record.archetype]->addEdges
+                         : m_archetypes[record.archetype]->removeEdges;
+    if (edges[id] == Archetype::NoEdge) {
+        const ComponentMask bit = ComponentMask{1} << id;
+        const ComponentMask sourceMask = m_archetypes[record.archetype]->mask();
+        edges[id] = archetypeFor(adding ? (sourceMask | bit) : (sourceMask & ~bit));
+    }
+    const uint32_t targetIndex = edges[id];
+
+    Archetype& source = *m_archetypes[record.archetype];
+    Archetype& target = *m_archetypes[targetIndex];
+    const uint32_t newRow = target.pushRow(entity);
+    target.copyRow(newRow, source, record.row);
+
+    if (const Entity moved = source.swapRemove(record.row); !moved.isNull()) {
+        m_records[moved.index()].row = record.row;
+    }
+
+    record.archetype = targetIndex;
+    record.row = newRow;
+    m_stats.archetypeMoves++;
+    return newRow;
+}
+
+void World::destroy(Entity entity) {
+    GAME_ASSERT(m_iterationDepth == 0, "World::destroy inside each(); use destroyLater()");
+    if (!contains(entity)) return;
+
+    EntityRecord& record = m_records[entity.index()];
+    if (const Entity moved = m_archetypes[record.archetype]->swapRemove(record.row); !moved.isNull()) {
+        m_records[moved.index()].row = record.row;
+    }
+
+    record.alive = false;
+    record.pendingDestroy = false;
+    record.generation = static_cast<uint16_t>(Entity::nextGeneration(record.generation));
+    m_freeIds.push_back(entity.index());
+    m_stats.entityCount--;
+}
+
+void World::destroyLater(Entity entity) {
+    if (!isAlive(entity)) return;
+
+    m_records[entity.index()].pendingDestroy = true;
+    m_pendingDestroy.push_back(entity);
+}
+
+void World::reserveEntities(size_t count) {
+    m_records.reserve(count);
+    m_freeIds.reserve(count);
+    m_pendingDestroy.reserve(count);
+}
+
+size_t World::tableBytes() const noexcept {
+    return m_records.capacity() * sizeof(EntityRecord) + m_freeIds.capacity() * sizeof(uint32_t) +
+           m_pendingDestroy.capacity() * sizeof(Entity) + m_archetypes.capacity() * sizeof(m_archetypes[0]) +
+           m_archetypes.size() * sizeof(Archetype);
+}
+
+void World::flush() {
+    for (const Entity entity : m_pendingDestroy) {
+        destroy(entity);
+    }
+    m_pendingDestroy.clear();
+}
+
+void World::clear() {
+    GAME_ASSERT(m_iterationDepth == 0, "World::clear inside each()");
+    for (auto& archetype : m_archetypes) {
+        archetype->clear();
+    }
+
+    m_freeIds.clear();
+    for (uint32_t index = static_cast<uint32_t>(m_records.size()); index-- > 0;) {
+        EntityRecord& record = m_records[index];
+        if (record.alive) {
+            record.generation = static_cast<uint16_t>(Entity::nextGeneration(record.generation));
+        }
+        record.alive = false;
+        record.pendingDestroy = false;
+        m_freeIds.push_back(index);
+    }
+    m_pendingDestroy.clear();
+    m_stats.entityCount = 0;
+}
+
+void World::save(BinaryWriter& writer, const ComponentEncoder& encoder) const {
+    GAME_ASSERT(m_iterationDepth == 0, "World::save inside each()");
+    writer.write(static_cast<uint32_t>(m_archetypes.size()));
+    for (const auto& archetype : m_archetypes) {
+        writer.write(archetype->mask());
+        archetype->save(writer, encoder);
+    }
+    writer.writeVector(m_records);
+    writer.writeVector(m_freeIds);
+    writer.writeVector(m_pendingDestroy);
+    writer.write(m_stats);
+}
+
+bool World::load(BinaryReader& reader) {
+    GAME_ASSERT(m_iterationDepth == 0, "World::load inside each()");
+    const ComponentMask registered = ComponentRegistry::count() >= MaxComponents ?
+        ~ComponentMask{0} : (ComponentMask{1} << ComponentRegistry::count()) - 1;
+    
+    uint32_t archetypeCount = 0;
+    bool ok = reader.read(archetypeCount) && archetypeCount > 0;
+    
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<ComponentMask, uint32_t> archetypeByMask;
+    for (uint32_t index = 0; ok && index < archetypeCount; ++index) {
+        ComponentMask mask = 0;
+        ok = reader.read(mask) && (mask & ~registered) == 0 && !archetypeByMask.count(mask);
+        if (!ok) break;
+        
+        std::unique_ptr<Archetype> archetype;
+        if (const auto it = m_archetypeByMask.find(mask); it != m_archetypeByMask.end()) {
+            archetype = std::move(m_archetypes[it->second]);
+        } else {
+            archetype = std::make_unique<Archetype>(mask);
+        }
+        
+        // Transitions are cached by index, and the indices change below
+        archetype->addEdges.fill(Archetype::NoEdge);
+        archetype->removeEdges.fill(Archetype::NoEdge);
+        ok = archetype->load(reader);
+        archetypeByMask.emplace(mask, index);
+        archetypes.push_back(std::move(archetype));
+    }
+    
+    // Archetypes the saved world didn't have are dropped, so ones created later
+    // get the same indices as in the saved world
+    if (!ok) {
+        for (auto& archetype : m_archetypes) {
+            if (archetype && !archetypeByMask.count(archetype->mask())) {
+                archetypeByMask.emplace(archetype->mask(), static_cast<uint32_t>(archetypes.size()));
+                archetypes.push_back(std::move(archetype));
+            }
+        }
+    }
+    m_archetypes = std::move(archetypes);
+    m_archetypeByMask = std::move(archetypeByMask);
+    if (m_archetypeByMask.find(0) == m_archetypeByMask.end()) {
+        archetypeFor(0);
+    }
+    
+    ok = ok && reader.readVector(m_records) && reader.readVector(m_freeIds) &&
+         reader.readVector(m_pendingDestroy) && reader.read(m_stats);
+    
+    // Every live record must point at the row holding its entity
+    for (uint32_t index = 0; ok && index < m_records.size(); ++index) {
+        const EntityRecord& record = m_records[index];
+        if (!record.alive) continue;
+        ok = record.archetype < m_archetypes.size() && record.row < m_archetypes[record.archetype]->size() &&
+             m_archetypes[record.archetype]->entities()[record.row] == Entity(index, record.generation);
+    }
+    
+    // And every row must be a live entity whose record points back at it, so no row is stray or duplicated
+    for (uint32_t archetypeIndex = 0; ok && archetypeIndex < m_archetypes.size(); ++archetypeIndex) {
+        const Archetype& archetype = *m_archetypes[archetypeIndex];
+        for (uint32_t row = 0; ok && row < archetype.size(); ++row) {
+            const Entity entity = archetype.entities()[row];
+            ok = contains(entity) && m_records[entity.index()].archetype == archetypeIndex &&
+                 m_records[entity.index()].row == row;
+        }
+    }
+    for (const uint32_t index : m_freeIds) {
+        ok = ok && index < m_records.size() && !m_records[index].alive;
+    }
+    for (const Entity entity : m_pendingDestroy) {
+        ok = ok && contains(entity);
+    }
+    
+    m_stats.archetypeCount = m_archetypes.size();
+    if (!ok) {
+        clear();
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -1,16 +1,120 @@
 #include "Game.hpp"
+#include "ReplayBenchmark.hpp"
+#include "BatchRunner.hpp"
 #include <iostream>
 #include <exception>
+#include <cstdlib>
+#include <string>
 #include <SFML/Graphics.hpp>
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --profile <name> selects a tuning profile from config/profiles.ini
+    // --record <file> saves each game as a replay; --seed <n> starts every game from the same seed
+    // --bot lets a scripted player play game after game; --bot-aggressiveness <0..1> also tunes it
+    // --replay <file> plays a replay headless instead of opening the window, checked against
+    //     --baseline <file> (or written to it with --write-baseline), with --threshold and --repeat
+    // --batch <games> plays that many headless bot games on --threads <n> from --seed, each capped at
+    //     --max-ticks <n>; --batch-replay <file> drives them with a replay's inputs, --csv <file> keeps per-game rows
+    // --memory-report <file> writes the per-subsystem memory report there on F2 and when the game closes
+    // --alloc-check fails the session or --replay if a tick (or frame) allocates once the game has warmed up;
+    //     it needs a build with SPACEDEFENDER_TRACK_ALLOCATIONS
+    // --host or --join <address> plays two-player co-op over UDP on --port <n>; --net-latency <ms>,
+    //     --net-jitter <ms> and --net-loss <fraction> degrade the link for testing
+    GameOptions options;
+    ReplayBenchmark::Options benchmark;
+    BatchRunner::Options batch;
+    bool runBatch = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        
+        // Flags take "--name value" or "--name=value"
+        std::string value;
+        const auto takeValue = [&](const std::string& name) {
+            if (arg == name && i + 1 < argc) {
+                value = argv[++i];
+                return true;
+            }
+            if (arg.rfind(name + "=", 0) == 0) {
+                value = arg.substr(name.size() + 1);
+                return true;
+            }
+            return false;
+        };
+        
+        if (takeValue("--profile")) {
+            options.profile = value;
+        } else if (takeValue("--record")) {
+            options.recordPath = value;
+        } else if (takeValue("--seed")) {
+            options.seed = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (arg == "--bot") {
+            options.bot = Config::BotAggressiveness;
+        } else if (takeValue("--bot-aggressiveness")) {
+            options.bot = std::strtof(value.c_str(), nullptr);
+        } else if (takeValue("--replay")) {
+            benchmark.replayPath = value;
+        } else if (takeValue("--baseline")) {
+            benchmark.baselinePath = value;
+        } else if (takeValue("--threshold")) {
+            benchmark.threshold = std::strtof(value.c_str(), nullptr);
+        } else if (takeValue("--repeat")) {
+            benchmark.repeat = std::atoi(value.c_str());
+        } else if (arg == "--write-baseline") {
+            benchmark.writeBaseline = true;
+        } else if (takeValue("--batch")) {
+            runBatch = true;
+            batch.games = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (takeValue("--batch-replay")) {
+            batch.replayPath = value;
+        } else if (takeValue("--threads")) {
+            batch.threads = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (takeValue("--max-ticks")) {
+            batch.maxTicks = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (takeValue("--csv")) {
+            batch.csvPath = value;
+        } else if (takeValue("--memory-report")) {
+            options.memoryReportPath = value;
+        } else if (arg == "--alloc-check") {
+            options.allocationCheck = true;
+            benchmark.allocationCheck = true;
+        } else if (arg == "--host") {
+            options.coop = RollbackSession::Role::Host;
+        } else if (takeValue("--join")) {
+            options.coop = RollbackSession::Role::Guest;
+            options.peerAddress = value;
+        } else if (takeValue("--port")) {
+            options.port = static_cast<unsigned short>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (takeValue("--net-latency")) {
+            options.link.latency = std::strtof(value.c_str(), nullptr) / 1000.0f;
+        } else if (takeValue("--net-jitter")) {
+            options.link.jitter = std::strtof(value.c_str(), nullptr) / 1000.0f;
+        } else if (takeValue("--net-loss")) {
+            options.link.loss = std::strtof(value.c_str(), nullptr);
+        }
+    }
+    
+    if (!benchmark.replayPath.empty()) {
+        return ReplayBenchmark::run(benchmark);
+    }
+    if (runBatch) {
+        if (!batch.replayPath.empty() && options.seed) {
+            std::cerr << "--seed can't be combined with --batch-replay; replay games use the recorded seed" << std::endl;
+            return 2;
+        }
+        batch.profile = options.profile;
+        batch.firstSeed = options.seed.value_or(batch.firstSeed);
+        batch.aggressiveness = options.bot.value_or(batch.aggressiveness);
+        return BatchRunner::run(batch);
+    }
+    
     std::cout << "=== Space Defender - Enhanced Edition ===" << std::endl;
     std::cout << "SFML Version: " << SFML_VERSION_MAJOR << "."
               << SFML_VERSION_MINOR << "." << SFML_VERSION_PATCH << std::endl;
     
     try {
-        Game game;
+        Game game(options);
         game.run();
+        if (!game.passedAllocationCheck()) return 1;
     } catch (const std::exception& e) {
         std::cerr << "Fatal error: " << e.what() << std::endl;
         return -1;
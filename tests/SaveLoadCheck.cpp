@@ -0,0 +1,240 @@
+// Checks that save() and load() capture the whole simulation: a game restored
+// from a save and stepped on must match the game it was saved from tick for
+// tick, down to the bytes of its next save. fork() is held to the same rule.
+// Saves with flipped bytes must be rejected and leave a game that still steps.
+//
+// Build with -DSPACEDEFENDER_BUILD_TESTS=ON, then run ctest or ./build/SaveLoadCheck
+
+#include "Simulation.hpp"
+#include "BotPlayer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr float TickSeconds = 1.0f / 60.0f;
+    constexpr int TicksBeforeSave = 400;
+    constexpr int TicksAfterSave = 1200;
+
+    struct Case {
+        uint32_t seed;
+        uint32_t textures;         // SimulationAssets::placeholders() mask; 0 draws shapes only
+        ParticlePolicy policy;
+        BroadphaseMode broadphase;
+    };
+
+    std::vector<std::byte> saved(const Simulation& simulation) {
+        std::vector<std::byte> buffer;
+        simulation.save(buffer);
+        return buffer;
+    }
+
+    bool sameProgress(const Simulation& a, const Simulation& b) {
+        return a.getTick() == b.getTick() && a.getScore() == b.getScore() &&
+               a.getEnemiesKilled() == b.getEnemiesKilled() && a.isGameOver() == b.isGameOver();
+    }
+
+    bool run(const Case& test) {
+        // Busy settings and a small particle budget, so spawning, combat and eviction all happen
+        RuntimeSettings settings;
+        settings.maxEnemies = 12;
+        settings.enemySpawnCooldown = 0.4f;
+        settings.maxParticles = 60;
+        settings.particlePolicy = test.policy;
+        settings.broadphase = test.broadphase;
+
+        const SimulationAssets assets = SimulationAssets::placeholders(test.textures);
+        const BotPlayer bot(0.3f);
+
+        Simulation original(test.seed);
+        original.setAssets(assets);
+        original.applySettings(settings);
+        original.startNewGame(test.seed);
+        for (int tick = 0; tick < TicksBeforeSave; ++tick) {
+            original.step(bot.decide(original), TickSeconds);
+        }
+
+        const std::vector<std::byte> checkpoint = saved(original);
+        Simulation restored(0);
+        restored.setAssets(assets);
+        if (!restored.load(checkpoint.data(), checkpoint.size())) {
+            std::printf("  load() rejected a fresh save\n");
+            return false;
+        }
+        if (saved(restored) != checkpoint) {
+            std::printf("  saving the restored game gives different bytes\n");
+            return false;
+        }
+        const std::unique_ptr<Simulation> forked = original.fork();
+
+        for (int tick = 0; tick < TicksAfterSave; ++tick) {
+            original.step(bot.decide(original), TickSeconds);
+            restored.step(bot.decide(restored), TickSeconds);
+            forked->step(bot.decide(*forked), TickSeconds);
+            if (!sameProgress(original, restored) || !sameProgress(original, *forked)) {
+                std::printf("  diverged at tick %llu: score %d, restored %d, forked %d\n",
+                            static_cast<unsigned long long>(original.getTick()), original.getScore(),
+                            restored.getScore(), forked->getScore());
+                return false;
+            }
+        }
+
+        const std::vector<std::byte> finalState = saved(original);
+        if (saved(restored) != finalState || saved(*forked) != finalState) {
+            std::printf("  same score and tick, but the saved states differ\n");
+            return false;
+        }
+        std::printf("  tick %llu, score %d\n", static_cast<unsigned long long>(original.getTick()),
+                    original.getScore());
+        return true;
+    }
+
+    // Offset of the first copy of value's bytes in buffer, or buffer.size()
+    template<typename T>
+    size_t find(const std::vector<std::byte>& buffer, const T& value) {
+        for (size_t offset = 0; offset + sizeof(T) <= buffer.size(); ++offset) {
+            if (std::memcmp(buffer.data() + offset, &value, sizeof(T)) == 0) return offset;
+        }
+        return buffer.size();
+    }
+
+    template<typename T>
+    void overwrite(std::vector<std::byte>& buffer, size_t offset, const T& value) {
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    bool rejects(const char* name, const std::vector<std::byte>& corrupt) {
+        // Loaded into a co-op game, so a leftover player count would show
+        Simulation simulation(0);
+        simulation.startNewGame(1, 2);
+        if (simulation.load(corrupt.data(), corrupt.size())) {
+            std::printf("  %s: load() accepted it\n", name);
+            return false;
+        }
+        if (simulation.getPlayerCount() != 1 || simulation.getTick() != 0) {
+            std::printf("  %s: rejected, but progress wasn't reset\n", name);
+            return false;
+        }
+        for (int tick = 0; tick < 60; ++tick) {
+            simulation.step(PlayerInput{}, TickSeconds);
+        }
+        std::printf("  %s: rejected\n", name);
+        return true;
+    }
+
+    // A row whose entity's record is dead, with every live record still pointing at its own row
+    bool rejectsStrayRow() {
+        // Mirrors World's saved EntityRecord
+        struct SavedRecord {
+            uint32_t archetype;
+            uint32_t row;
+            uint16_t generation;
+            bool alive;
+            bool pendingDestroy;
+        };
+
+        World world;
+        world.create();
+        const Entity last = world.create();
+        std::vector<std::byte> buffer;
+        BinaryWriter writer(buffer);
+        world.save(writer);
+
+        // The records follow the rows of the only archetype, after their count
+        const size_t records = find(buffer, last) + sizeof(Entity) + sizeof(uint64_t);
+        overwrite(buffer, records + sizeof(SavedRecord) + offsetof(SavedRecord, alive), false);
+
+        World loaded;
+        BinaryReader reader(buffer.data(), buffer.size());
+        if (loaded.load(reader)) {
+            std::printf("  row with a dead record: load() accepted it\n");
+            return false;
+        }
+        std::printf("  row with a dead record: rejected\n");
+        return true;
+    }
+
+    bool rejectsCorruptSaves() {
+        RuntimeSettings settings;
+        settings.maxEnemies = 12;
+        settings.enemySpawnCooldown = 0.4f;
+        const BotPlayer bot(0.3f);
+        Simulation simulation(3);
+        simulation.applySettings(settings);
+        simulation.startNewGame(3);
+        for (int tick = 0; tick < TicksBeforeSave; ++tick) {
+            simulation.step(bot.decide(simulation), TickSeconds);
+        }
+        const std::vector<std::byte> checkpoint = saved(simulation);
+
+        std::vector<Entity> enemies;
+        std::vector<EnemyAI> ais;
+        simulation.getWorld().each<EnemyAI>([&](Entity entity, const EnemyAI& ai) {
+            enemies.push_back(entity);
+            ais.push_back(ai);
+        });
+        if (enemies.size() < 2) {
+            std::printf("  too few enemies to corrupt\n");
+            return false;
+        }
+
+        bool ok = true;
+        std::vector<std::byte> settingsBytes;
+        BinaryWriter settingsWriter(settingsBytes);
+        settings.save(settingsWriter);
+        // Magic, version, settings, texture slots, tick and game over come before the player count
+        const size_t playerCountOffset = 2 * sizeof(uint32_t) + settingsBytes.size() + 8 + sizeof(uint64_t) + 1;
+        for (const uint32_t playerCount : {0u, static_cast<uint32_t>(Config::MaxPlayers) + 1}) {
+            std::vector<std::byte> corrupt = checkpoint;
+            overwrite(corrupt, playerCountOffset, playerCount);
+            ok = rejects(playerCount ? "too many players" : "no players", corrupt) && ok;
+        }
+
+        // The entity list of the enemies' archetype is the first place their handles appear
+        const size_t second = find(checkpoint, enemies[1]);
+        std::vector<std::byte> duplicated = checkpoint;
+        overwrite(duplicated, second, enemies[0]);
+        ok = rejects("duplicated row", duplicated) && ok;
+
+        std::vector<std::byte> stray = checkpoint;
+        overwrite(stray, second, Entity(enemies[1].index(), Entity::nextGeneration(enemies[1].generation())));
+        ok = rejects("row with no live entity", stray) && ok;
+
+        EnemyAI badType = ais[0];
+        badType.type = static_cast<EnemyType>(EnemyTypeCount);
+        std::vector<std::byte> enemyType = checkpoint;
+        overwrite(enemyType, find(checkpoint, ais[0]), badType);
+        ok = rejects("unknown enemy type", enemyType) && ok;
+        return rejectsStrayRow() && ok;
+    }
+}
+
+int main() {
+    int failures = 0;
+    for (const uint32_t seed : {1u, 7u, 1234u}) {
+        for (const uint32_t textures : {0xFFu, 0x00u}) {
+            for (const ParticlePolicy policy : {ParticlePolicy::Drop, ParticlePolicy::EvictOldest,
+                                                ParticlePolicy::Grow}) {
+                const BroadphaseMode broadphase = seed == 7 ? BroadphaseMode::BruteForce
+                                                            : BroadphaseMode::SortAndSweep;
+                std::printf("seed %u, %s, particles %s, %s\n", seed, textures ? "sprites" : "shapes",
+                            ParticleSystem::policyName(policy),
+                            broadphase == BroadphaseMode::BruteForce ? "brute" : "sweep");
+                if (!run({seed, textures, policy, broadphase})) {
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    std::printf("corrupt saves\n");
+    if (!rejectsCorruptSaves()) {
+        ++failures;
+    }
+
+    std::printf("%s: %d failing case%s\n", failures ? "FAILED" : "OK", failures, failures == 1 ? "" : "s");
+    return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+// Checks the Utils::Simd kernels: every ISA the CPU supports must give the
+// scalar kernels' output bit for bit, since gameplay runs on whichever one is
+// active, and the scalar kernels must stay within their documented error.
+//
+// Build with -DSPACEDEFENDER_BUILD_TESTS=ON, then run ctest or ./build/SimdCheck
+
+#include "UtilsSimd.hpp"
+#include "Utils.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+    using Utils::Simd::Isa;
+
+    // Not a multiple of any vector width, so every kernel runs its tail loop
+    constexpr size_t Count = 4099;
+    constexpr double SinCosTolerance = 1e-7;
+    constexpr double Atan2Tolerance = 3e-7;
+
+    struct Inputs {
+        std::vector<float> x, y, angles;
+        std::vector<float> left, top, right, bottom;
+    };
+
+    struct Outputs {
+        std::vector<float> normalX, normalY, sines, cosines, angles;
+        std::vector<uint32_t> overlaps;
+        size_t overlapCount = 0;
+    };
+
+    Inputs makeInputs() {
+        std::mt19937 rng(20240601);
+        std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> angle(-8192.0f, 8192.0f);
+        std::uniform_real_distribution<float> extent(1.0f, 80.0f);
+
+        Inputs in;
+        for (size_t i = 0; i < Count; ++i) {
+            in.x.push_back(coordinate(rng));
+            in.y.push_back(coordinate(rng));
+            in.angles.push_back(angle(rng));
+            in.left.push_back(coordinate(rng) * 0.2f);
+            in.top.push_back(coordinate(rng) * 0.2f);
+            in.right.push_back(in.left.back() + extent(rng));
+            in.bottom.push_back(in.top.back() + extent(rng));
+        }
+
+        // Edge cases: zero vectors, signed zeros, axes, octant boundaries and the range limit
+        const float special[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.78539816f, 1.5707964f, 3.1415927f, -3.1415927f,
+                                 8192.0f, -8192.0f, 1e-30f, -1e-30f};
+        for (size_t i = 0; i < std::size(special); ++i) {
+            in.x[i] = special[i];
+            in.y[i] = special[(i + 1) % std::size(special)];
+            in.angles[i] = special[i];
+        }
+        in.x[20] = in.y[20] = 0.0f;
+        in.x[21] = -0.0f;
+        in.y[21] = 0.0f;
+
+        // A box touching the query edge to edge, which must not count
+        in.left[30] = 50.0f;
+        in.right[30] = 60.0f;
+        return in;
+    }
+
+    Outputs runKernels(const Inputs& in) {
+        Outputs out;
+        out.normalX = in.x;
+        out.normalY = in.y;
+        Utils::Simd::normalize(out.normalX.data(), out.normalY.data(), Count);
+
+        out.sines.resize(Count);
+        out.cosines.resize(Count);
+        Utils::Simd::sincos(in.angles.data(), out.sines.data(), out.cosines.data(), Count);
+
+        out.angles.resize(Count);
+        Utils::Simd::atan2(in.y.data(), in.x.data(), out.angles.data(), Count);
+
+        out.overlaps.resize(Count);
+        const sf::FloatRect box({-40.0f, -40.0f}, {90.0f, 90.0f});
+        out.overlapCount = Utils::Simd::overlapping(in.left.data(), in.top.data(), in.right.data(),
+                                                    in.bottom.data(), Count, box, out.overlaps.data());
+        out.overlaps.resize(out.overlapCount);
+        return out;
+    }
+
+    template<typename T>
+    bool sameBits(const char* name, const std::vector<T>& expected, const std::vector<T>& actual) {
+        if (expected.size() == actual.size() &&
+            std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(T)) == 0) {
+            return true;
+        }
+        std::printf("  %s differs from scalar\n", name);
+        return false;
+    }
+
+    // The scalar kernels against double-precision libm and the single-value helpers in Utils.hpp
+    bool checkReference(const Inputs& in, const Outputs& out) {
+        bool ok = true;
+        double sinCosError = 0.0;
+        double atan2Error = 0.0;
+        for (size_t i = 0; i < Count; ++i) {
+            sinCosError = std::max(sinCosError, std::abs(out.sines[i] - std::sin(double{in.angles[i]})));
+            sinCosError = std::max(sinCosError, std::abs(out.cosines[i] - std::cos(double{in.angles[i]})));
+            const double expected = in.x[i] == 0.0f && in.y[i] == 0.0f ?
+                0.0 : std::atan2(double{in.y[i]}, double{in.x[i]});
+            atan2Error = std::max(atan2Error, std::abs(out.angles[i] - expected));
+
+            const sf::Vector2f normal = Utils::normalize({in.x[i], in.y[i]});
+            if (normal.x != out.normalX[i] || normal.y != out.normalY[i]) {
+                std::printf("  normalize(%g, %g) differs from Utils::normalize\n", in.x[i], in.y[i]);
+                ok = false;
+                break;
+            }
+        }
+        std::printf("  sincos max error %.2g, atan2 max error %.2g\n", sinCosError, atan2Error);
+        if (sinCosError > SinCosTolerance || atan2Error > Atan2Tolerance) {
+            std::printf("  error above the documented bound\n");
+            ok = false;
+        }
+
+        const sf::FloatRect box({-40.0f, -40.0f}, {90.0f, 90.0f});
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < Count; ++i) {
+            const sf::FloatRect rect({in.left[i], in.top[i]}, {in.right[i] - in.left[i], in.bottom[i] - in.top[i]});
+            if (Utils::rectIntersects(rect, box)) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return sameBits("overlapping vs Utils::rectIntersects", expected, out.overlaps) && ok;
+    }
+}
+
+int main() {
+    const Inputs in = makeInputs();
+    const Isa best = Utils::Simd::activeIsa();
+
+    Utils::Simd::selectIsa(Isa::Scalar);
+    std::printf("scalar\n");
+    const Outputs reference = runKernels(in);
+    bool ok = checkReference(in, reference);
+
+    for (const Isa isa : {Isa::SSE2, Isa::AVX2}) {
+        if (Utils::Simd::selectIsa(isa) != isa) {
+            std::printf("%s: not supported here, skipped\n", Utils::Simd::isaName(isa));
+            continue;
+        }
+        std::printf("%s\n", Utils::Simd::isaName(isa));
+        const Outputs out = runKernels(in);
+        ok = sameBits("normalize x", reference.normalX, out.normalX) & ok;
+        ok = sameBits("normalize y", reference.normalY, out.normalY) & ok;
+        ok = sameBits("sin", reference.sines, out.sines) & ok;
+        ok = sameBits("cos", reference.cosines, out.cosines) & ok;
+        ok = sameBits("atan2", reference.angles, out.angles) & ok;
+        ok = sameBits("overlapping", reference.overlaps, out.overlaps) & ok;
+    }
+    Utils::Simd::selectIsa(best);
+
+    std::printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
\ No newline at end of file